@@ -0,0 +1,186 @@
+//  Times the common drawing calls, and some this driver adds, and prints the results
+//  to Serial as CSV.
+//
+//  Each case runs RUNS times on the same workload, so results from different boards,
+//  or builds of the library, can be compared directly - set TAG to tell them apart,
+//  and paste the output into a spreadsheet.  Times are in microseconds; pixels_per_s
+//  is at the median time.
+//
+//  The touch case reads the controller, so it includes the SPI traffic for the
+//  readings as well as the filtering.
+
+#include <Arduino.h>
+
+#include <SPI.h>
+
+#include <Adafruit_GFX.h>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_Benchmark.h>
+
+#define BLACK   0x0000
+#define BLUE    0x001F
+#define RED     0xF800
+#define GREEN   0x07E0
+#define YELLOW  0xFFE0
+#define WHITE   0xFFFF
+
+#if defined(ARDUINO_BOARD)
+#define TAG ARDUINO_BOARD
+#else
+#define TAG "unknown"
+#endif
+
+namespace
+{
+    Waveshare_ILI9486 Waveshield;
+
+#if defined(ARDUINO_ARCH_AVR)
+    constexpr uint16_t RUNS = 8;
+    constexpr int16_t BLIT = 16;
+    constexpr uint16_t STORM = 200;
+#else
+    constexpr uint16_t RUNS = 32;
+    constexpr int16_t BLIT = 64;
+    constexpr uint16_t STORM = 1000;
+#endif
+
+    Waveshare_ILI9486_Benchmark<RUNS> bench(Serial, TAG);
+
+    uint16_t blit[BLIT * BLIT];
+    WavesharePoint storm[STORM];
+
+    void prepare()
+    {
+        for (int16_t y = 0; y < BLIT; y++)
+        {
+            for (int16_t x = 0; x < BLIT; x++)
+            {
+                blit[y * BLIT + x] = ((x * 31 / BLIT) << 11) | ((y * 63 / BLIT) << 5);
+            }
+        }
+
+        //  The same scattered points every time.
+        uint32_t seed = 12345;
+        for (uint16_t i = 0; i < STORM; i++)
+        {
+            seed = seed * 1103515245 + 12345;
+            storm[i].x = (seed >> 16) % 320;
+            seed = seed * 1103515245 + 12345;
+            storm[i].y = (seed >> 16) % 480;
+        }
+    }
+
+    void runAll()
+    {
+        Waveshield.setRotation(0);
+        bench.printHeader();
+
+        bench.run(F("fillScreen"), RUNS, 320UL * 480, []()
+        {
+            Waveshield.fillScreen(BLUE);
+        });
+
+        bench.run(F("fillRect 100x100"), RUNS, 100UL * 100, []()
+        {
+            Waveshield.fillRect(110, 190, 100, 100, RED);
+        });
+
+        bench.run(F("drawFastHLine x100"), RUNS, 100UL * 200, []()
+        {
+            for (int16_t y = 0; y < 100; y++)
+            {
+                Waveshield.drawFastHLine(60, 100 + y, 200, GREEN);
+            }
+        });
+
+        bench.run(F("drawFastVLine x100"), RUNS, 100UL * 200, []()
+        {
+            for (int16_t x = 0; x < 100; x++)
+            {
+                Waveshield.drawFastVLine(110 + x, 140, 200, YELLOW);
+            }
+        });
+
+        bench.run(F("drawLine x50"), RUNS, 0, []()
+        {
+            for (int16_t i = 0; i < 50; i++)
+            {
+                Waveshield.drawLine(0, 0, 319, i * 9, WHITE);
+            }
+        });
+
+        bench.run(F("fillCircle r50"), RUNS, 0, []()
+        {
+            Waveshield.fillCircle(160, 240, 50, GREEN);
+        });
+
+        bench.run(F("fillTriangle"), RUNS, 0, []()
+        {
+            Waveshield.fillTriangle(20, 400, 160, 80, 300, 400, RED);
+        });
+
+        bench.run(F("text 100 chars"), RUNS, 0, []()
+        {
+            Waveshield.setCursor(0, 0);
+            Waveshield.setTextColor(WHITE, BLACK);
+            Waveshield.setTextSize(1);
+            for (uint8_t i = 0; i < 100; i++)
+            {
+                Waveshield.write('A' + (i % 26));
+            }
+        });
+
+        bench.run(F("drawColors blit x4"), RUNS, 4UL * BLIT * BLIT, []()
+        {
+            for (uint8_t i = 0; i < 4; i++)
+            {
+                Waveshield.drawColors(i * 70, i * 100, BLIT, BLIT, blit);
+            }
+        });
+
+        bench.run(F("writePixel storm"), RUNS, STORM, []()
+        {
+            Waveshield.startWrite();
+            for (uint16_t i = 0; i < STORM; i++)
+            {
+                Waveshield.writePixel(storm[i].x, storm[i].y, WHITE);
+            }
+            Waveshield.endWrite();
+        });
+
+        bench.run(F("drawPixels storm"), RUNS, STORM, []()
+        {
+            Waveshield.drawPixels(storm, STORM, YELLOW);
+        });
+
+        bench.run(F("setRotation x4"), RUNS, 0, []()
+        {
+            for (uint8_t r = 0; r < 4; r++)
+            {
+                Waveshield.setRotation(r);
+            }
+        });
+
+        bench.run(F("getPoint"), RUNS, 0, []()
+        {
+            TSPoint p = Waveshield.getPoint();
+            Waveshield.normalizeTsPoint(p);
+        });
+
+        Waveshield.setRotation(0);
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    SPI.begin();
+    Waveshield.begin();
+
+    prepare();
+    runAll();
+}
+
+void loop()
+{
+}
@@ -0,0 +1,75 @@
+//  Records a touch trace while you draw, and prints it to Serial.
+//
+//  Draw on the screen for ten seconds.  The trace is then printed as C source, in the
+//  format 'printTo()' writes.  Save it to a file, and replay it on a desktop with the
+//  host build - test/touch_replay.cpp runs it through 'getPoint()' and
+//  'normalizeTsPoint()', no stylus needed, and reports the valid sample rate, stroke
+//  latency and filtering cost.  Each variant of the pipeline (NUMSAMPLES, 'slop',
+//  calibration) can then be run over the same trace:
+//
+//      cmake -S test -B build -DWAVESHARE_ILI9486_TOUCH_TRACE=/path/to/trace.h
+//      cmake --build build && build/touch_replay
+
+#include <Arduino.h>
+
+#include <SPI.h>
+
+#include <Adafruit_GFX.h>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_TouchTrace.h>
+
+#define BLACK   0x0000
+#define BLUE    0x001F
+#define WHITE   0xFFFF
+
+namespace
+{
+    Waveshare_ILI9486 Waveshield;
+
+#if defined(ARDUINO_ARCH_AVR)
+    constexpr uint16_t TRACE_SAMPLES = 256;
+#else
+    constexpr uint16_t TRACE_SAMPLES = 4096;
+#endif
+    Waveshare_ILI9486_TouchTrace::Sample samples[TRACE_SAMPLES];
+    Waveshare_ILI9486_TouchTrace trace(samples, TRACE_SAMPLES);
+
+    constexpr uint32_t RECORD_MS = 10000;
+
+    void record()
+    {
+        Waveshield.setTextSize(2);
+        Waveshield.print("Draw for ten seconds");
+
+        trace.startRecording();
+        const uint32_t start = millis();
+        while ((millis() - start < RECORD_MS) && !trace.isFull())
+        {
+            TSPoint p = Waveshield.getPoint();
+            Waveshield.normalizeTsPoint(p);
+            if (p.z != 0)
+            {
+                Waveshield.fillCircle(p.x, p.y, 3, BLUE);
+            }
+        }
+        trace.stop();
+
+        trace.printTo(Serial);
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    SPI.begin();
+    Waveshield.begin();
+    Waveshield.attachTouchTrace(&trace);
+
+    record();
+
+    Waveshield.attachTouchTrace(nullptr);
+}
+
+void loop()
+{
+}
@@ -25,10 +25,16 @@
 #include <Adafruit_GFX.h>
 
 #include "Waveshare_ILI9486.h"
+#include "Waveshare_ILI9486_Shadow.h"
+#include "Waveshare_ILI9486_TouchTrace.h"
+#include "Waveshare_ILI9486_Transport.h"
 
 
 namespace
 {
+	//  Fastest way to get bytes out on this platform, see Waveshare_ILI9486_Transport.h.
+	typedef Waveshare_ILI9486_Transport::Transport Transport;
+
 #ifdef ARDUINO_ESP8266_WEMOS_D1R1
 	//GPIO config
 	//LCD
@@ -101,38 +107,65 @@ namespace
 	//  Touch screen wants 400 ns period.
 	SPISettings tsSpiSettings(2500000, MSBFIRST, SPI_MODE0);
 
+	//  Last value written to Memory Access Control (0x36).
+	uint8_t memoryAccessControl = 0x08;
 
-	inline void lcdWriteReg(uint8_t reg)
+	//  Optional RLE copy of the screen, see Waveshare_ILI9486_Shadow.h.  Every write to
+	//  the panel below is mirrored to it.
+	Waveshare_ILI9486_Shadow *pShadow = nullptr;
+
+	//  Bus hold nesting, see 'beginBusHold()'.  'busOpen' is TRUE while the LCD has the
+	//  SPI transaction and chip select.
+	uint8_t busHoldDepth = 0;
+	bool busOpen = false;
+
+#ifdef ARDUINO_ARCH_ESP32
+	//  The task that opened the bus.  With Waveshare_ILI9486_RenderTask running that's
+	//  the render task, not whoever is polling the touch screen.
+	TaskHandle_t busOwner = nullptr;
+#endif
+
+	inline void lcdReleaseBus()
 	{
+		if (!busOpen) return;
 
-		digitalWrite(LCD_DC, LOW);
-#ifdef ARDUINO_ESP32_DEV
-		SPI.write16(reg);
-#else
-		SPI.transfer(0);
-		SPI.transfer(reg);
+		Transport::flush();
+		digitalWrite(LCD_CS, HIGH);
+#ifdef ARDUINO_ARCH_ESP32
+		busOwner = nullptr;
+#endif
+		busOpen = false;
+		SPI.endTransaction();
+	}
+
+	//  For touch reads and 'yieldBus()' - only closes the bus if the calling task opened
+	//  it.  On ESP32 another task's open transaction holds the SPI lock, so the caller's
+	//  own 'SPI.beginTransaction()' just waits for that task to let go.
+	inline void lcdReleaseOwnBus()
+	{
+#ifdef ARDUINO_ARCH_ESP32
+		if (busOwner != xTaskGetCurrentTaskHandle()) return;
 #endif
+		lcdReleaseBus();
+	}
+
+
+	inline void lcdWriteReg(uint8_t reg)
+	{
+		Transport::flush();
+		digitalWrite(LCD_DC, LOW);
+		Transport::writeCommand16(reg);
 	}
 
 	inline void lcdWriteData(uint8_t data)
 	{
 		digitalWrite(LCD_DC, HIGH);
-#ifdef ARDUINO_ESP32_DEV
-		SPI.write16(data);
-#else
-		SPI.transfer(0);
-		SPI.transfer(data);
-#endif
+		Transport::writeCommand16(data);
 	}
 
 	inline void lcdWriteDataContinue(uint8_t data)
 	{
-#ifdef ARDUINO_ESP32_DEV
-		SPI.write16(data);
-#else
-		SPI.transfer(0);
-		SPI.transfer(data);
-#endif
+		Transport::writeCommand16(data);
 	}
 
 
@@ -148,121 +181,144 @@ namespace
 		lcdWriteDataContinue(uint8_t(data & 0xff));
 	}
 
-#ifdef ARDUINO_ARCH_AVR
-	//  Version of SPI.transfer(...) that *doesn't* read data back into the buffer.
-	//  
 
-	//  Wrote this, then went with a bulk repeat implementation instead.
-	//inline static void transferOut(void *buf, size_t count)
-	//{
-	//	if (count == 0) return;
-	//	uint8_t *p = (uint8_t *)buf;
-	//	SPDR = *p++;
-	//	while (--count > 0)
-	//	{
-	//		uint8_t out = *p++;
-	//		while (!(SPSR & _BV(SPIF)));
-	//		SPDR = out;
-	//	}
-	//	while (!(SPSR & _BV(SPIF)));
-	//}
+	//  Memory write (RAMWR).  Pixel data follows, starting at the top left of the
+	//  active rectangle.
+	inline void lcdStartPixels()
+	{
+		lcdWriteReg(0x2C);
+		digitalWrite(LCD_DC, HIGH);
 
+		if (pShadow) pShadow->startPixels();
+	}
 
-	inline static void transfer16Repeat(uint16_t data, unsigned long count)
+	//  Memory write continue (0x3C).  Pixel data carries on from wherever the last write
+	//  left off.
+	inline void lcdContinuePixels()
 	{
-		if (count == 0)
+		lcdWriteReg(0x3C);
+		digitalWrite(LCD_DC, HIGH);
+	}
+
+	//  The '...Raw' functions just stream pixel data, so several can follow one
+	//  'lcdStartPixels()' to fill a single window.
+	inline void lcdWriteRepeatRaw(uint16_t data, unsigned long count)
+	{
+		if (pShadow) pShadow->writeRepeat(data, count);
+
+		Transport::writeRepeat(data, count);
+	}
+
+	//  Longest pattern 'lcdWritePatternRaw' takes.  The ESP32 and ESP8266 SPI FIFOs are
+	//  64 bytes.
+	constexpr uint8_t MAX_PATTERN = 32;
+
+	inline void lcdWriteCountRaw(const uint16_t *pData, unsigned long count)
+	{
+		if (pShadow) pShadow->writePixels(pData, count);
+
+		Transport::writeBuffer(pData, count);
+	}
+
+	//  The same, for pixels that stay put until the drawing call returns.  Can still be
+	//  going out when this returns.
+	inline void lcdWriteCountRawAsync(const uint16_t *pData, unsigned long count)
+	{
+		if (pShadow) pShadow->writePixels(pData, count);
+
+		Transport::writeBufferAsync(pData, count);
+	}
+
+	//  Sends 'count' pixels, 'repeat' times over.
+	inline void lcdWritePatternRaw(const uint16_t *pPattern, uint8_t count, unsigned long repeat)
+	{
+		if (count == 1)
 		{
+			lcdWriteRepeatRaw(pPattern[0], repeat);
 			return;
 		}
 
-		//  Fast way to split a 16bit into into 2 8 bit ints.
-		union
+		if (pShadow)
 		{
-			uint16_t val;
-			struct
+			for (unsigned long i = 0; i < repeat; i++)
 			{
-				uint8_t lsb; uint8_t msb;
-			};
-		} in;
-		in.val = data;
-
-		//  Slightly faster using these, I think the optimizer can take advantage that
-		//  there is no aliasing?
-		const uint8_t msb = in.msb;
-		const uint8_t lsb = in.lsb;
-
-		//  Loop phase shifting AND Duff's device?  Inconceivable!
-		SPDR = msb;
-		count--;
-		while (!(SPSR & _BV(SPIF)));
-		SPDR = lsb;
-		switch (count & 0x01)
-		{
-		case 0:
-			while (count)
-			{
-				count--;
-				while (!(SPSR & _BV(SPIF)));
-				SPDR = msb;
-				asm volatile("nop");
-				while (!(SPSR & _BV(SPIF)));
-				SPDR = lsb;
-		case 1:
-			count--;
-			while (!(SPSR & _BV(SPIF)));
-			SPDR = msb;
-			asm volatile("nop");
-			while (!(SPSR & _BV(SPIF)));
-			SPDR = lsb;
+				pShadow->writePixels(pPattern, count);
 			}
 		}
-		// MUST wait for final shift out to complete!  Otherwise subsequent commands
-		// happen quickly enough to stomp on it.
-		asm volatile("nop");
-		while (!(SPSR & _BV(SPIF)));
 
+		//  Where there's a FIFO, the hardware repeats it, the same as solid fills.
+		uint8_t pattern[2 * MAX_PATTERN];
+		for (uint8_t i = 0; i < count; i++)
+		{
+			pattern[2 * i] = pPattern[i] >> 8;
+			pattern[2 * i + 1] = pPattern[i] & 0xff;
+		}
+
+		Transport::writePattern(pattern, 2 * count, repeat);
 	}
-#endif
 
-	inline void lcdWriteDataRepeat(uint16_t data, unsigned long count)
+	//  8 bit gray to RGB565.
+	inline uint16_t grayTo565(uint8_t gray)
 	{
-		lcdWriteReg(0x2C);
-		digitalWrite(LCD_DC, HIGH);
-
-#ifdef ARDUINO_ARCH_ESP32
-		//
-		//  ESP8266 seems to have better bulk transfer APIs for SPI.  
-		uint8_t pattern[2];
-		pattern[0] = data >> 8;
-		pattern[1] = data & 0xff;
-
-		SPI.writePattern(pattern, 2, count);
+		return ((uint16_t)(gray & 0xF8) << 8) | ((uint16_t)(gray & 0xFC) << 3) | (gray >> 3);
+	}
 
-#elif defined ARDUINO_ARCH_AVR
-		//  On AVR it's pretty easy to write a better bulk repeat directly, so use that.
-		transfer16Repeat(data, count);
-#else
-		//  Otherwise, just do it the boring way.
-		for (unsigned long i = 0; i < count; i++)
+	//  Pixels stored in PROGMEM.
+	inline void lcdWriteProgmemRaw(const uint16_t *pData, unsigned long count)
+	{
+#if defined ARDUINO_ARCH_AVR && !defined WAVESHARE_ILI9486_HOST
+		if (!pShadow)
 		{
-			SPI.transfer16(data);
+			Transport::writeProgmem(pData, count);
+			return;
 		}
 #endif
+		//  Copy out a chunk at a time - flash isn't directly addressable everywhere.
+		uint16_t chunk[MAX_PATTERN];
+		while (count > 0)
+		{
+			const uint8_t n = (count < MAX_PATTERN) ? count : MAX_PATTERN;
+			for (uint8_t i = 0; i < n; i++)
+			{
+				chunk[i] = pgm_read_word(pData++);
+			}
+			lcdWriteCountRaw(chunk, n);
+			count -= n;
+		}
 	}
 
-	inline void lcdWriteDataCount(uint16_t *pData, unsigned long count)
+	inline void lcdWriteGrayProgmemRaw(const uint8_t *pData, unsigned long count)
 	{
-		lcdWriteReg(0x2C);
-		digitalWrite(LCD_DC, HIGH);
-
-#ifdef ARDUINO_ESP32_DEV
-		SPI.writePixels((const uint8_t *)pData, count * 2);
-#else
-		while (count--)
+#if defined ARDUINO_ARCH_AVR && !defined WAVESHARE_ILI9486_HOST
+		if (!pShadow)
 		{
-			SPI.transfer16(*pData++);
+			Transport::writeGrayProgmem(pData, count);
+			return;
 		}
 #endif
+		uint16_t chunk[MAX_PATTERN];
+		while (count > 0)
+		{
+			const uint8_t n = (count < MAX_PATTERN) ? count : MAX_PATTERN;
+			for (uint8_t i = 0; i < n; i++)
+			{
+				chunk[i] = grayTo565(pgm_read_byte(pData++));
+			}
+			lcdWriteCountRaw(chunk, n);
+			count -= n;
+		}
+	}
+
+	inline void lcdWriteDataRepeat(uint16_t data, unsigned long count)
+	{
+		lcdStartPixels();
+		lcdWriteRepeatRaw(data, count);
+	}
+
+	inline void lcdWriteDataCount(uint16_t *pData, unsigned long count)
+	{
+		lcdStartPixels();
+		lcdWriteCountRaw(pData, count);
 	}
 
 	inline void lcdWriteCommand(uint8_t reg, uint8_t data)
@@ -271,6 +327,22 @@ namespace
 		lcdWriteData(data);
 	}
 
+	//  What the column (0x2A) and page (0x2B) address registers hold, so an unchanged
+	//  range isn't sent again.  Only trusted while 'windowKnown' is TRUE.
+	bool windowKnown = false;
+	uint16_t windowColStart, windowColEnd, windowPageStart, windowPageEnd;
+
+	inline void lcdSetMemoryAccess(uint8_t madctl)
+	{
+		//  The registers keep their values, but what they mean changes.  Start over.
+		windowKnown = false;
+
+		lcdWriteCommand(0x36, madctl);
+		memoryAccessControl = madctl;
+
+		if (pShadow) pShadow->setMemoryAccess(madctl);
+	}
+
 	inline void lcdWriteCommand(uint8_t reg, uint8_t data, uint8_t data2)
 	{
 		lcdWriteReg(reg);
@@ -278,6 +350,70 @@ namespace
 		lcdWriteDataContinue(data2);
 	}
 
+	//  Power, gamma and control settings sent by 'initializeLcd()'.  Each entry is the
+	//  register, the number of parameters, then the parameters.
+	const uint8_t initCommands[] PROGMEM =
+	{
+		0xC0, 2, 0x19, 0x1a,                //  Power control settings
+		0xC1, 2, 0x45, 0x00,
+		0xC2, 1, 0x33,                      //  Power/Reset on default
+
+		0xC5, 2, 0x00, 0x28,                //  VCOM control
+
+		0xB1, 2, 0xA0, 0x11,                //  Frame rate control
+
+		0xB4, 1, 0x02,                      //  Display Z Inversion
+
+		0xB6, 3, 0x00, 0x42, 0x3B,          //  Display Control Function
+
+		0xE0, 15,                           //  Positive Gamma control
+			0x1F, 0x25, 0x22, 0x0B, 0x06, 0x0A, 0x4E, 0xC6,
+			0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+		0xE1, 15,                           //  Negative Gamma control
+			0x1F, 0x3F, 0x3F, 0x0F, 0x1F, 0x0F, 0x46, 0x49,
+			0x31, 0x05, 0x09, 0x03, 0x1C, 0x1A, 0x00,
+
+		//  From original driver, but register numbers don't make any sense.
+		//0xF1, 8, 0x36, 0x04, 0x00, 0x3C, 0x0F, 0x0F, 0xA4, 0x02,
+		//0xF2, 9, 0x18, 0xA3, 0x12, 0x02, 0x32, 0x12, 0xFF, 0x32, 0x00,
+		//0xF4, 5, 0x40, 0x00, 0x08, 0x91, 0x04,
+		//0xF8, 2, 0x21, 0x04,
+
+		0x3A, 1, 0x55,                      //  16 bit pixels
+
+		0xB6, 2, 0x00, 0x22,
+	};
+
+	//  Most parameters any entry in 'initCommands' has.
+	constexpr uint8_t MAX_COMMAND_PARAMETERS = 15;
+
+	//  Sends a PROGMEM table laid out like 'initCommands'.  Each command's parameters go
+	//  out as one block, rather than a frame at a time.
+	void lcdWriteCommandList(const uint8_t *pList, size_t length)
+	{
+		uint8_t frames[2 * MAX_COMMAND_PARAMETERS];
+
+		const uint8_t *pEnd = pList + length;
+		while (pList < pEnd)
+		{
+			const uint8_t reg = pgm_read_byte(pList++);
+			const uint8_t count = pgm_read_byte(pList++);
+			for (uint8_t i = 0; i < count; i++)
+			{
+				frames[2 * i] = 0;
+				frames[2 * i + 1] = pgm_read_byte(pList++);
+			}
+
+			lcdWriteReg(reg);
+			if (count > 0)
+			{
+				digitalWrite(LCD_DC, HIGH);
+				Transport::writeBytes(frames, 2 * count);
+			}
+		}
+	}
+
 	struct ActiveBounds
 	{
 		uint8_t data[8];
@@ -290,15 +426,148 @@ namespace
 
 		//  Writing datablocks is quite a bit faster than transfering out one byte at a
 		//  time.
-		ActiveBounds b = {0, (uint8_t)(xStart >> 8), 0, (uint8_t)(xStart & 0xFF), 0, (uint8_t)(xEnd >> 8), 0, (uint8_t)(xEnd & 0xFF)};
-		lcdWriteReg(0x2a);
-		digitalWrite(LCD_DC, HIGH);
-		SPI.writeBytes((byte *)&b, sizeof(b));
+		if (!windowKnown || (xStart != windowColStart) || (xEnd != windowColEnd))
+		{
+			ActiveBounds b = {0, (uint8_t)(xStart >> 8), 0, (uint8_t)(xStart & 0xFF), 0, (uint8_t)(xEnd >> 8), 0, (uint8_t)(xEnd & 0xFF)};
+			lcdWriteReg(0x2a);
+			digitalWrite(LCD_DC, HIGH);
+			Transport::writeBytes(b.data, sizeof(b));
+		}
 
-		b = {0, (uint8_t)(yStart >> 8), 0, (uint8_t)(yStart & 0xFF), 0, (uint8_t)(yEnd >> 8), 0, (uint8_t)(yEnd & 0xFF)};
-		lcdWriteReg(0x2b);
-		digitalWrite(LCD_DC, HIGH);
-		SPI.writeBytes((byte *)&b, sizeof(b));
+		if (!windowKnown || (yStart != windowPageStart) || (yEnd != windowPageEnd))
+		{
+			ActiveBounds b = {0, (uint8_t)(yStart >> 8), 0, (uint8_t)(yStart & 0xFF), 0, (uint8_t)(yEnd >> 8), 0, (uint8_t)(yEnd & 0xFF)};
+			lcdWriteReg(0x2b);
+			digitalWrite(LCD_DC, HIGH);
+			Transport::writeBytes(b.data, sizeof(b));
+		}
+
+		windowKnown = true;
+		windowColStart = xStart;
+		windowColEnd = xEnd;
+		windowPageStart = yStart;
+		windowPageEnd = yEnd;
+
+		if (pShadow) pShadow->setWindow(xStart, xEnd, yStart, yEnd);
+	}
+
+	//  Steps a color from 'color0' to 'color1', one channel at a time in 16.16 fixed
+	//  point.
+	class GradientStepper
+	{
+	public:
+		//  'steps' is the number of colors from end to end, 'start' is where to begin.
+		GradientStepper(uint16_t color0, uint16_t color1, int32_t steps, int32_t start)
+		{
+			init(_r, _dr, color0 >> 11, color1 >> 11, steps, start);
+			init(_g, _dg, (color0 >> 5) & 0x3F, (color1 >> 5) & 0x3F, steps, start);
+			init(_b, _db, color0 & 0x1F, color1 & 0x1F, steps, start);
+		}
+
+		uint16_t color() const
+		{
+			return (uint16_t)(((_r >> 16) << 11) | ((_g >> 16) << 5) | (_b >> 16));
+		}
+
+		void step()
+		{
+			_r += _dr;
+			_g += _dg;
+			_b += _db;
+		}
+
+	private:
+		static void init(int32_t &value, int32_t &delta, int32_t from, int32_t to, int32_t steps, int32_t start)
+		{
+			delta = (steps > 1) ? ((to - from) * 65536L) / (steps - 1) : 0;
+			//  Round to nearest.
+			value = (from << 16) + delta * start + 0x8000;
+		}
+
+		int32_t _r, _g, _b;
+		int32_t _dr, _dg, _db;
+	};
+
+	//  0x00RRGGBB to RGB565 - all three fields shifted into place at once.
+	inline uint16_t rgb888To565(uint32_t rgb)
+	{
+		return (uint16_t)(((rgb >> 8) & 0xF800) | ((rgb >> 5) & 0x07E0) | ((rgb >> 3) & 0x001F));
+	}
+
+	//  Same, for 0x..BBGGRR - three bytes of an R, G, B stream loaded as a little
+	//  endian word.  The top byte is ignored.
+	inline uint16_t bgr888To565(uint32_t bgr)
+	{
+		return (uint16_t)(((bgr << 8) & 0xF800) | ((bgr >> 5) & 0x07E0) | ((bgr >> 19) & 0x001F));
+	}
+
+	//  Blends 0xAARRGGBB over a background, two channels per multiply - red and blue
+	//  share one word, with 8 bits of headroom each, and green gets the other.  The
+	//  background is pre-split into 'bgRB' (0x00RR00BB) and 'bgG' (0x0000GG00).
+	inline uint16_t blendARGB8888(uint32_t argb, uint32_t bgRB, uint32_t bgG)
+	{
+		uint32_t alpha = argb >> 24;
+		if (alpha == 0xFF) return rgb888To565(argb);
+		if (alpha == 0) return rgb888To565(bgRB | bgG);
+
+		//  0 - 256, so the weights add up to a power of two.
+		alpha += alpha >> 7;
+		const uint32_t inverse = 256 - alpha;
+
+		const uint32_t rb = (((argb & 0xFF00FF) * alpha + bgRB * inverse) >> 8) & 0xFF00FF;
+		const uint32_t g = (((argb & 0x00FF00) * alpha + bgG * inverse) >> 8) & 0x00FF00;
+		return rgb888To565(rb | g);
+	}
+
+	//  MADCTL bits that change how addresses map onto the panel.
+	constexpr uint8_t MADCTL_MY = 0x80;
+	constexpr uint8_t MADCTL_MX = 0x40;
+	constexpr uint8_t MADCTL_MV = 0x20;
+	constexpr uint8_t MADCTL_ORIENTATION = MADCTL_MY | MADCTL_MX | MADCTL_MV;
+
+	//  Address (column, page) to panel co-ordinates, under memory access control
+	//  'madctl'.  Row / column exchange happens first, then the mirroring.
+	void addressToPanel(uint8_t madctl, int16_t col, int16_t page, int16_t &x, int16_t &y)
+	{
+		const int16_t a = (madctl & MADCTL_MV) ? page : col;
+		const int16_t b = (madctl & MADCTL_MV) ? col : page;
+		x = (madctl & MADCTL_MX) ? LCD_WIDTH - 1 - a : a;
+		y = (madctl & MADCTL_MY) ? LCD_HEIGHT - 1 - b : b;
+	}
+
+	void panelToAddress(uint8_t madctl, int16_t x, int16_t y, int16_t &col, int16_t &page)
+	{
+		const int16_t a = (madctl & MADCTL_MX) ? LCD_WIDTH - 1 - x : x;
+		const int16_t b = (madctl & MADCTL_MY) ? LCD_HEIGHT - 1 - y : y;
+		col = (madctl & MADCTL_MV) ? b : a;
+		page = (madctl & MADCTL_MV) ? a : b;
+	}
+
+	//  Where the next source pixel lands on screen for each WaveshareTransform - one
+	//  step along a source row, then one step down a column.
+	struct TransformSteps
+	{
+		int8_t colX, colY;
+		int8_t rowX, rowY;
+	};
+
+	const TransformSteps transformSteps[] =
+	{
+		{  1,  0,    0,  1 },   //  TRANSFORM_NONE
+		{  0,  1,   -1,  0 },   //  TRANSFORM_ROTATE_90
+		{ -1,  0,    0, -1 },   //  TRANSFORM_ROTATE_180
+		{  0, -1,    1,  0 },   //  TRANSFORM_ROTATE_270
+		{ -1,  0,    0,  1 },   //  TRANSFORM_MIRROR_X
+		{  1,  0,    0, -1 },   //  TRANSFORM_MIRROR_Y
+	};
+
+	//  RGB565 to 0x00RRGGBB, replicating the top bits so white stays white.
+	inline uint32_t rgb565To888(uint16_t color)
+	{
+		const uint32_t r = (color >> 11) & 0x1F;
+		const uint32_t g = (color >> 5) & 0x3F;
+		const uint32_t b = color & 0x1F;
+		return (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
 	}
 }
 
@@ -318,8 +587,11 @@ namespace Waveshare_ILI9486_Impl
 
 		pinMode(TP_CS, OUTPUT);
 		digitalWrite(TP_CS, HIGH);
+#ifndef ARDUINO_ESP8266_WEMOS_D1R1
+		//  Not wired up on the D1 R1, there aren't enough pins.
 		pinMode(TP_IRQ, INPUT_PULLUP);
 		pinMode(TP_BUSY, INPUT_PULLUP);
+#endif
 
 		pinMode(SD_CS, OUTPUT);
 		digitalWrite(SD_CS, HIGH);
@@ -327,122 +599,59 @@ namespace Waveshare_ILI9486_Impl
 
 	void startWrite()
 	{
+		//  Still open from earlier in a bus hold.
+		if (busOpen) return;
+
 		SPI.beginTransaction(_tftSpiSettingsWrite);
 		digitalWrite(LCD_CS, LOW);
+		busOpen = true;
+#ifdef ARDUINO_ARCH_ESP32
+		busOwner = xTaskGetCurrentTaskHandle();
+#endif
 	}
 
-	void initializeLcd()
+	void initializeLcd(bool clearScreen)
 	{
-		//  Trigger hardware reset.
-		digitalWrite(LCD_RST, HIGH);
-		delay(5);
+		//  Trigger hardware reset.  'initializePins()' has already left it high.
 		digitalWrite(LCD_RST, LOW);
 		delayMicroseconds(20);
 		digitalWrite(LCD_RST, HIGH);
+		const unsigned long resetTime = millis();
 
-		//  TO-DO - how long after a reset until the screen can be used?  Doesn't seem to be
-		//  specified in the datasheet.
-		//  Experimentally, any less than this and the initial screen clear is incomplete.
-		delay(65);
+		//  Datasheet wants 5 ms after a reset before the first command.
+		delay(5);
+		windowKnown = false;
 
 		startWrite();
 		{
-			//  Power control settings
-			lcdWriteCommand(0xC0, 0x19, 0x1a);
-			lcdWriteCommand(0xC1, 0x45, 0x00);
-			lcdWriteCommand(0xC2, 0x33);        //  Power/Reset on default
-
-			lcdWriteCommand(0xC5, 0x00, 0x28);  //  VCOM control
-
-			lcdWriteCommand(0xB1, 0xA0, 0x11);  //  Frame rate control
-
-			lcdWriteCommand(0xB4, 0x02);        //  Display Z Inversion
-
-			lcdWriteReg(0xB6);                  //  Display Control Function      
-			lcdWriteData(0x00);
-			lcdWriteDataContinue(0x42);
-			lcdWriteDataContinue(0x3B);
-
-			lcdWriteReg(0xE0);                  //  Positive Gamma control
-			lcdWriteData(0x1F);
-			lcdWriteDataContinue(0x25);
-			lcdWriteDataContinue(0x22);
-			lcdWriteDataContinue(0x0B);
-			lcdWriteDataContinue(0x06);
-			lcdWriteDataContinue(0x0A);
-			lcdWriteDataContinue(0x4E);
-			lcdWriteDataContinue(0xC6);
-			lcdWriteDataContinue(0x39);
-			lcdWriteDataContinue(0x00);
-			lcdWriteDataContinue(0x00);
-			lcdWriteDataContinue(0x00);
-			lcdWriteDataContinue(0x00);
-			lcdWriteDataContinue(0x00);
-			lcdWriteDataContinue(0x00);
-
-			lcdWriteReg(0XE1);                  //  Negative Gamma control
-			lcdWriteData(0x1F);
-			lcdWriteDataContinue(0x3F);
-			lcdWriteDataContinue(0x3F);
-			lcdWriteDataContinue(0x0F);
-			lcdWriteDataContinue(0x1F);
-			lcdWriteDataContinue(0x0F);
-			lcdWriteDataContinue(0x46);
-			lcdWriteDataContinue(0x49);
-			lcdWriteDataContinue(0x31);
-			lcdWriteDataContinue(0x05);
-			lcdWriteDataContinue(0x09);
-			lcdWriteDataContinue(0x03);
-			lcdWriteDataContinue(0x1C);
-			lcdWriteDataContinue(0x1A);
-			lcdWriteDataContinue(0x00);
-
-			//  From original driver, but register numbers don't make any sense.
-			if (0)
-			{
-				lcdWriteReg(0XF1);
-				lcdWriteData(0x36);
-				lcdWriteDataContinue(0x04);
-				lcdWriteDataContinue(0x00);
-				lcdWriteDataContinue(0x3C);
-				lcdWriteDataContinue(0x0F);
-				lcdWriteDataContinue(0x0F);
-				lcdWriteDataContinue(0xA4);
-				lcdWriteDataContinue(0x02);
-
-				lcdWriteReg(0XF2);
-				lcdWriteData(0x18);
-				lcdWriteDataContinue(0xA3);
-				lcdWriteDataContinue(0x12);
-				lcdWriteDataContinue(0x02);
-				lcdWriteDataContinue(0x32);
-				lcdWriteDataContinue(0x12);
-				lcdWriteDataContinue(0xFF);
-				lcdWriteDataContinue(0x32);
-				lcdWriteDataContinue(0x00);
-
-				lcdWriteReg(0XF4);
-				lcdWriteData(0x40);
-				lcdWriteDataContinue(0x00);
-				lcdWriteDataContinue(0x08);
-				lcdWriteDataContinue(0x91);
-				lcdWriteDataContinue(0x04);
-
-				lcdWriteReg(0XF8);
-				lcdWriteData(0x21);
-				lcdWriteDataContinue(0x04);
-			}
-
-			lcdWriteCommand(0x3A, 0x55);
+			lcdWriteCommandList(initCommands, sizeof(initCommands));
 
 			//  Set initial rotation to match AFX defaults - tall / narrow
-			lcdWriteCommand(0xB6, 0x00, 0x22);
-			lcdWriteCommand(0x36, 0x08);
+			lcdSetMemoryAccess(0x08);
+		}
+		endWrite();
 
+		//  TO-DO - how long after a reset until the screen can be used?  Doesn't seem to be
+		//  specified in the datasheet.
+		//  Experimentally, any less than 65 ms and the initial screen clear is incomplete.
+		//  Sending the settings above used up some of that already.  Sleep Out waits
+		//  as well - the 65 ms was only ever measured with it sent afterwards.
+		const unsigned long elapsed = millis() - resetTime;
+		if (elapsed < 65)
+		{
+			delay(65 - elapsed);
+		}
+
+		startWrite();
+		{
 			lcdWriteReg(0x11); // Sleep out
 
-			//  Fill screen to black
-			writeFillRect2(0, 0, LCD_WIDTH, LCD_HEIGHT, 0x0000);
+			//  Fill screen to black.  Skipping this leaves whatever was in GRAM on screen,
+			//  until the application draws over it.
+			if (clearScreen)
+			{
+				writeFillRect2(0, 0, LCD_WIDTH, LCD_HEIGHT, 0x0000);
+			}
 
 			lcdWriteReg(0x29);  // Turn on display
 		}
@@ -457,6 +666,163 @@ namespace Waveshare_ILI9486_Impl
 	}
 
 
+	void writePixels(const WavesharePoint *pPoints, const uint16_t *pColors, uint16_t color,
+		uint16_t count, int16_t originX, int16_t originY,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		if ((count == 0) || (clipW <= 0) || (clipH <= 0)) return;
+
+		//  Row start indexes, then the visible points in row order.
+		uint16_t *pRowEnd = (uint16_t *)malloc(((uint32_t)clipH + 1 + count) * sizeof(uint16_t));
+		if (pRowEnd == nullptr)
+		{
+			//  No room to sort, so one window per pixel.
+			for (uint16_t i = 0; i < count; i++)
+			{
+				const int16_t x = pPoints[i].x + originX;
+				const int16_t y = pPoints[i].y + originY;
+				if ((x >= clipX) && (y >= clipY) && (x < clipX + clipW) && (y < clipY + clipH))
+				{
+					writeFillRect2(x, y, 1, 1, pColors ? pColors[i] : color);
+				}
+			}
+			return;
+		}
+		uint16_t *pOrder = pRowEnd + clipH + 1;
+
+		//  Counting sort by row.  Afterwards row r is pOrder[pRowEnd[r - 1] .. pRowEnd[r]),
+		//  with pRowEnd[-1] being 0.
+		memset(pRowEnd, 0, ((uint32_t)clipH + 1) * sizeof(uint16_t));
+		for (uint16_t i = 0; i < count; i++)
+		{
+			const int16_t x = pPoints[i].x + originX;
+			const int16_t y = pPoints[i].y + originY;
+			if ((x >= clipX) && (y >= clipY) && (x < clipX + clipW) && (y < clipY + clipH))
+			{
+				pRowEnd[y - clipY + 1]++;
+			}
+		}
+		for (int16_t r = 1; r <= clipH; r++)
+		{
+			pRowEnd[r] += pRowEnd[r - 1];
+		}
+		for (uint16_t i = 0; i < count; i++)
+		{
+			const int16_t x = pPoints[i].x + originX;
+			const int16_t y = pPoints[i].y + originY;
+			if ((x >= clipX) && (y >= clipY) && (x < clipX + clipW) && (y < clipY + clipH))
+			{
+				pOrder[pRowEnd[y - clipY]++] = i;
+			}
+		}
+
+		//  Where the next pixel written would go, while that's known.  A run starting
+		//  there is sent with a write continue, no window needed.  Windows run to the
+		//  bottom of the clip, so a column of points carries on row after row.
+		const int16_t bottom = clipY + clipH;
+		bool pointerKnown = false;
+		int16_t pointerX = 0, pointerY = 0;
+		int16_t windowLeft = 0, windowRight = 0;
+
+		uint16_t first = 0;
+		for (int16_t r = 0; r < clipH; r++)
+		{
+			const uint16_t last = pRowEnd[r];
+			const int16_t y = clipY + r;
+
+			//  Column order.  Insertion sort is stable, so of two points on the same
+			//  pixel the later one is drawn.
+			for (uint16_t i = first + 1; i < last; i++)
+			{
+				const uint16_t index = pOrder[i];
+				const int16_t x = pPoints[index].x;
+				uint16_t j = i;
+				while ((j > first) && (pPoints[pOrder[j - 1]].x > x))
+				{
+					pOrder[j] = pOrder[j - 1];
+					j--;
+				}
+				pOrder[j] = index;
+			}
+
+			uint16_t i = first;
+			while (i < last)
+			{
+				//  Run of neighbouring columns, duplicates included.
+				const int16_t x = pPoints[pOrder[i]].x + originX;
+				uint16_t end = i + 1;
+				int16_t length = 1;
+				while (end < last)
+				{
+					const int16_t next = pPoints[pOrder[end]].x + originX;
+					if (next == x + length)
+					{
+						length++;
+					}
+					else if (next != x + length - 1)
+					{
+						break;
+					}
+					end++;
+				}
+
+				if (pointerKnown && (pointerX == x) && (pointerY == y) && (x + length - 1 <= windowRight))
+				{
+					lcdContinuePixels();
+				}
+				else
+				{
+					lcdWriteActiveRect(x, y, length, bottom - y);
+					lcdStartPixels();
+					windowLeft = x;
+					windowRight = x + length - 1;
+					pointerX = x;
+					pointerY = y;
+				}
+
+				if (pColors == nullptr)
+				{
+					lcdWriteRepeatRaw(color, length);
+					i = end;
+				}
+				else
+				{
+					//  Colors a chunk at a time, the last of any duplicates winning.
+					uint16_t chunk[MAX_PATTERN];
+					uint8_t n = 0;
+					int16_t column = x - 1;
+					while (i < end)
+					{
+						const uint16_t index = pOrder[i++];
+						if (pPoints[index].x + originX != column)
+						{
+							if (n == MAX_PATTERN)
+							{
+								lcdWriteCountRaw(chunk, n);
+								n = 0;
+							}
+							n++;
+							column++;
+						}
+						chunk[n - 1] = pColors[index];
+					}
+					lcdWriteCountRaw(chunk, n);
+				}
+
+				pointerX += length;
+				if (pointerX > windowRight)
+				{
+					pointerX = windowLeft;
+					pointerY++;
+				}
+				pointerKnown = pointerY < bottom;
+			}
+			first = last;
+		}
+
+		free(pRowEnd);
+	}
+
 	void writeColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors)
 	{
 		lcdWriteActiveRect(x, y, w, h);
@@ -464,10 +830,365 @@ namespace Waveshare_ILI9486_Impl
 		lcdWriteDataCount(pColors, (unsigned long)w * (unsigned long)h);
 	}
 
+	void writeColorsRegion(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		//  The caller's pixels stay put until we return, so they can go out without
+		//  waiting row by row.
+		if (stride == w)
+		{
+			//  Rows are back to back, so it's one block.
+			lcdWriteCountRawAsync(pColors, (unsigned long)w * (unsigned long)h);
+		}
+		else
+		{
+			for (int16_t row = 0; row < h; row++, pColors += stride)
+			{
+				lcdWriteCountRawAsync(pColors, w);
+			}
+		}
+		Transport::flush();
+	}
+
+	void writeGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color0, uint16_t color1, uint8_t direction,
+		int16_t xOffset, int16_t yOffset, int16_t fullW, int16_t fullH)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		switch (direction)
+		{
+		case GRADIENT_VERTICAL:
+		{
+			//  Every row is a solid color - one bulk repeat each.
+			GradientStepper stepper(color0, color1, fullH, yOffset);
+			for (int16_t row = 0; row < h; row++, stepper.step())
+			{
+				lcdWriteRepeatRaw(stepper.color(), w);
+			}
+			break;
+		}
+
+		case GRADIENT_HORIZONTAL:
+			if (w <= MAX_PATTERN)
+			{
+				//  Every row is the same, so the whole thing is a single pattern.
+				uint16_t row[MAX_PATTERN];
+				GradientStepper stepper(color0, color1, fullW, xOffset);
+				for (int16_t col = 0; col < w; col++, stepper.step())
+				{
+					row[col] = stepper.color();
+				}
+				lcdWritePatternRaw(row, w, h);
+				break;
+			}
+			//  Fall through - too wide for a pattern, so do it run by run like diagonal.
+
+		default:
+		{
+			//  Walk each row, and send runs of the same color as bulk repeats.  There
+			//  are at most 64 shades end to end, so runs are usually long.
+			const bool diagonal = (direction == GRADIENT_DIAGONAL);
+			const int32_t steps = diagonal ? (int32_t)fullW + fullH - 1 : fullW;
+			for (int16_t row = 0; row < h; row++)
+			{
+				GradientStepper stepper(color0, color1, steps,
+					diagonal ? (int32_t)xOffset + yOffset + row : xOffset);
+
+				uint16_t color = stepper.color();
+				int16_t run = 0;
+				for (int16_t col = 0; col < w; col++, stepper.step())
+				{
+					uint16_t next = stepper.color();
+					if (next != color)
+					{
+						lcdWriteRepeatRaw(color, run);
+						color = next;
+						run = 0;
+					}
+					run++;
+				}
+				lcdWriteRepeatRaw(color, run);
+			}
+			break;
+		}
+		}
+	}
+
+	void writePattern(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pTile, uint8_t tileW, uint8_t tileH)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		//  The tile is anchored to the screen origin, so neighbouring fills line up.
+		const uint8_t phase = x % tileW;
+		const unsigned long repeats = w / tileW;
+		const uint8_t remainder = w % tileW;
+
+		uint16_t row[MAX_PATTERN];
+		for (int16_t line = 0; line < h; line++)
+		{
+			const uint16_t *pRow = pTile + ((y + line) % tileH) * tileW;
+			for (uint8_t i = 0; i < tileW; i++)
+			{
+				row[i] = pRow[(phase + i) % tileW];
+			}
+
+			if ((tileH == 1) && (remainder == 0))
+			{
+				//  Rows all line up end to end - send everything at once.
+				lcdWritePatternRaw(row, tileW, repeats * h);
+				break;
+			}
+
+			if (repeats > 0)
+			{
+				lcdWritePatternRaw(row, tileW, repeats);
+			}
+			if (remainder > 0)
+			{
+				lcdWriteCountRaw(row, remainder);
+			}
+		}
+	}
+
+	void writeMonoBitmap(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pBits, int16_t stride, int16_t srcX, uint16_t color, uint16_t bg)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		//  Expand into a small buffer and send that in bulk.
+		uint16_t chunk[MAX_PATTERN];
+		uint8_t used = 0;
+		for (int16_t row = 0; row < h; row++, pBits += stride)
+		{
+			for (int16_t col = srcX; col < srcX + w; col++)
+			{
+				chunk[used++] = (pBits[col >> 3] & (0x80 >> (col & 7))) ? color : bg;
+				if (used == MAX_PATTERN)
+				{
+					lcdWriteCountRaw(chunk, used);
+					used = 0;
+				}
+			}
+		}
+		lcdWriteCountRaw(chunk, used);
+	}
+
+	void writeColorsProgmem(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		if (stride == w)
+		{
+			lcdWriteProgmemRaw(pColors, (unsigned long)w * (unsigned long)h);
+			return;
+		}
+
+		for (int16_t row = 0; row < h; row++, pColors += stride)
+		{
+			lcdWriteProgmemRaw(pColors, w);
+		}
+	}
+
+	void writeGrayscaleProgmem(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pGray, int16_t stride)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		if (stride == w)
+		{
+			lcdWriteGrayProgmemRaw(pGray, (unsigned long)w * (unsigned long)h);
+			return;
+		}
+
+		for (int16_t row = 0; row < h; row++, pGray += stride)
+		{
+			lcdWriteGrayProgmemRaw(pGray, w);
+		}
+	}
+
+	void writeRGB888(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pRGB, int16_t stride)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		//  Convert a chunk at a time, no full size copy.
+		uint16_t chunk[MAX_PATTERN];
+		uint8_t used = 0;
+		for (int16_t row = 0; row < h; row++, pRGB += 3 * (int32_t)stride)
+		{
+			const uint8_t *pPixel = pRGB;
+			int16_t col = 0;
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+			//  4 pixels are exactly 3 words - load them whole and pull the pixels out
+			//  with shifts, instead of a byte at a time.  Conversion is a small part of
+			//  the time the pixels take on the bus (test/bench_rgb888.cpp), so there's
+			//  no SIMD version.
+			for (; col + 4 <= w; col += 4, pPixel += 12)
+			{
+				if (used > MAX_PATTERN - 4)
+				{
+					lcdWriteCountRaw(chunk, used);
+					used = 0;
+				}
+
+				uint32_t words[3];
+				memcpy(words, pPixel, sizeof(words));
+				chunk[used++] = bgr888To565(words[0]);
+				chunk[used++] = bgr888To565((words[0] >> 24) | (words[1] << 8));
+				chunk[used++] = bgr888To565((words[1] >> 16) | (words[2] << 16));
+				chunk[used++] = bgr888To565(words[2] >> 8);
+			}
+#endif
+
+			for (; col < w; col++, pPixel += 3)
+			{
+				if (used == MAX_PATTERN)
+				{
+					lcdWriteCountRaw(chunk, used);
+					used = 0;
+				}
+
+				chunk[used++] = rgb888To565(((uint32_t)pPixel[0] << 16) | ((uint32_t)pPixel[1] << 8) | pPixel[2]);
+			}
+		}
+		lcdWriteCountRaw(chunk, used);
+	}
+
+	void writeARGB8888(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint32_t *pARGB, int16_t stride, bool blend, uint16_t bg)
+	{
+		lcdWriteActiveRect(x, y, w, h);
+		lcdStartPixels();
+
+		const uint32_t bg888 = rgb565To888(bg);
+		const uint32_t bgRB = bg888 & 0xFF00FF;
+		const uint32_t bgG = bg888 & 0x00FF00;
+
+		uint16_t chunk[MAX_PATTERN];
+		uint8_t used = 0;
+		for (int16_t row = 0; row < h; row++, pARGB += stride)
+		{
+			for (int16_t col = 0; col < w; col++)
+			{
+				chunk[used++] = blend ? blendARGB8888(pARGB[col], bgRB, bgG) : rgb888To565(pARGB[col]);
+				if (used == MAX_PATTERN)
+				{
+					lcdWriteCountRaw(chunk, used);
+					used = 0;
+				}
+			}
+		}
+		lcdWriteCountRaw(chunk, used);
+	}
+
+	void writeColorsTransformed(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t srcW, int16_t srcH, uint8_t transform,
+		int16_t xOffset, int16_t yOffset)
+	{
+		const TransformSteps &steps = transformSteps[transform];
+
+		//  Where source (0, 0) lands, relative to the transformed image.
+		const int16_t originX = ((steps.colX < 0) ? srcW - 1 : 0) + ((steps.rowX < 0) ? srcH - 1 : 0);
+		const int16_t originY = ((steps.colY < 0) ? srcW - 1 : 0) + ((steps.rowY < 0) ? srcH - 1 : 0);
+
+		//  Source rectangle behind the visible part.  The steps are unit vectors, so a dot
+		//  product takes an output position back to the source.
+		int16_t u = xOffset - originX, v = yOffset - originY;
+		int16_t sx0 = u * steps.colX + v * steps.colY;
+		int16_t sy0 = u * steps.rowX + v * steps.rowY;
+		u += w - 1;
+		v += h - 1;
+		int16_t sx1 = u * steps.colX + v * steps.colY;
+		int16_t sy1 = u * steps.rowX + v * steps.rowY;
+		if (sx0 > sx1)
+		{
+			int16_t t = sx0; sx0 = sx1; sx1 = t;
+		}
+		if (sy0 > sy1)
+		{
+			int16_t t = sy0; sy0 = sy1; sy1 = t;
+		}
+
+		//  First pixel sent, on screen, then on the panel along with the direction the
+		//  source rows and columns have to run there.
+		const int16_t firstX = x - xOffset + originX + sx0 * steps.colX + sy0 * steps.rowX;
+		const int16_t firstY = y - yOffset + originY + sx0 * steps.colY + sy0 * steps.rowY;
+
+		const uint8_t madctl = memoryAccessControl;
+		int16_t panelX, panelY, colX, colY, rowX, rowY;
+		addressToPanel(madctl, firstX, firstY, panelX, panelY);
+		addressToPanel(madctl, firstX + steps.colX, firstY + steps.colY, colX, colY);
+		addressToPanel(madctl, firstX + steps.rowX, firstY + steps.rowY, rowX, rowY);
+		colX -= panelX;
+		colY -= panelY;
+		rowX -= panelX;
+		rowY -= panelY;
+
+		//  One of the eight orientations has the panel's own column and page counters
+		//  running the same way.
+		for (uint8_t orientation = 0; orientation < 8; orientation++)
+		{
+			const uint8_t candidate = (madctl & ~MADCTL_ORIENTATION) | (orientation << 5);
+
+			int16_t x0, y0, x1, y1, x2, y2;
+			addressToPanel(candidate, 0, 0, x0, y0);
+			addressToPanel(candidate, 1, 0, x1, y1);
+			addressToPanel(candidate, 0, 1, x2, y2);
+			if ((x1 - x0 != colX) || (y1 - y0 != colY) || (x2 - x0 != rowX) || (y2 - y0 != rowY))
+			{
+				continue;
+			}
+
+			int16_t col, page;
+			panelToAddress(candidate, panelX, panelY, col, page);
+
+			lcdSetMemoryAccess(candidate);
+			writeColorsRegion(col, page, sx1 - sx0 + 1, sy1 - sy0 + 1,
+				pColors + (int32_t)sy0 * srcW + sx0, srcW);
+			lcdSetMemoryAccess(madctl);
+			return;
+		}
+	}
+
 	void endWrite()
 	{
-		digitalWrite(LCD_CS, HIGH);
-		SPI.endTransaction();
+		//  A bus hold keeps it open until the hold ends, or something else needs the bus.
+		if (busHoldDepth > 0) return;
+
+		lcdReleaseBus();
+	}
+
+	void beginBusHold()
+	{
+		busHoldDepth++;
+	}
+
+	void endBusHold()
+	{
+		if (busHoldDepth == 0) return;
+
+		if (--busHoldDepth == 0)
+		{
+			lcdReleaseBus();
+		}
+	}
+
+	void yieldBus()
+	{
+		lcdReleaseOwnBus();
 	}
 
 	void setRotation(uint8_t r)
@@ -495,7 +1216,7 @@ namespace Waveshare_ILI9486_Impl
 
 		startWrite();
 		{
-			lcdWriteCommand(0x36, MemoryAccessControl_0x36);
+			lcdSetMemoryAccess(MemoryAccessControl_0x36);
 		}
 		endWrite();
 	}
@@ -518,6 +1239,29 @@ namespace Waveshare_ILI9486_Impl
 		endWrite();
 	}
 
+	void setShadow(Waveshare_ILI9486_Shadow *pNewShadow)
+	{
+		pShadow = pNewShadow;
+		if (pShadow) pShadow->setMemoryAccess(memoryAccessControl);
+	}
+
+	bool readPixels(int16_t x, int16_t y, int16_t w, uint16_t *pColors)
+	{
+		if ((pShadow == nullptr) || !pShadow->isValid())
+		{
+			return false;
+		}
+
+		//  Screen co-ordinates are just addresses under the current rotation.
+		for (int16_t i = 0; i < w; i++)
+		{
+			int16_t panelX, panelY;
+			pShadow->addressToPanel(x + i, y, panelX, panelY);
+			pColors[i] = pShadow->readPixel(panelX, panelY);
+		}
+		return true;
+	}
+
 	void setScreenBrightness(uint8_t brightness)
 	{
 		analogWrite(LCD_BL, brightness);
@@ -527,8 +1271,19 @@ namespace Waveshare_ILI9486_Impl
 	{
 		return SD_CS;
 	}
+
+#ifdef WAVESHARE_ILI9486_HOST
+	uint32_t hostBytesWritten()
+	{
+		return Transport::bytesWritten;
+	}
+#endif
 }
 
+#ifdef WAVESHARE_ILI9486_HOST
+uint32_t Waveshare_ILI9486_Transport::HostTransport::bytesWritten = 0;
+#endif
+
 //  Touchscreen interface
 
 // increase or decrease the touchscreen oversampling. This is a little different than you make think:
@@ -589,10 +1344,20 @@ static void insert_sort(int array[], uint8_t size)
 
 namespace
 {
+	Waveshare_ILI9486_TouchTrace *pTouchTrace = nullptr;
+
 	uint16_t readChannel(uint8_t channel)
 	{
 		uint16_t data = 0;
 
+		if ((pTouchTrace != nullptr) && pTouchTrace->isReplaying())
+		{
+			return pTouchTrace->replay(channel);
+		}
+
+		//  Take the bus back if a bus hold has it.  The next LCD write reopens it.
+		lcdReleaseOwnBus();
+
 		SPI.beginTransaction(tsSpiSettings);
 		digitalWrite(TP_CS, LOW);
 
@@ -609,10 +1374,20 @@ namespace
 		digitalWrite(TP_CS, HIGH);
 		SPI.endTransaction();
 
+		if (pTouchTrace != nullptr)
+		{
+			pTouchTrace->record(channel, data);
+		}
 		return data;
 	}
 }
 
+void
+WaveshareTouchScreen::attachTouchTrace(Waveshare_ILI9486_TouchTrace *pTrace)
+{
+	pTouchTrace = pTrace;
+}
+
 //  Approx resistance of the touchplate across the X-axis
 constexpr uint16_t _rxplate = 300;
 
@@ -752,15 +1527,6 @@ WaveshareTouchScreen::resetTsConfigData()
 }
 
 
-namespace
-{
-	void swap(int16_t &x, int16_t &y)
-	{
-		int16_t t = x;
-		x = y;
-		y = t;
-	}
-}
 //  Normalize the touchscreen readings to the dimensions of the screen.  Automatically
 //  adjusts the limits over time.  To calibrate, just run the stylus off each of the four
 //  edges of the screen.
@@ -768,6 +1534,17 @@ bool
 WaveshareTouchScreen::normalizeTsPoint(
 	TSPoint &p,
 	uint8_t rotation)
+{
+	const bool fReturn = calibrateTsPoint(p);
+	rotateTsPoint(p, rotation);
+
+	return fReturn;
+}
+
+//  The calibration and mapping half of 'normalizeTsPoint()', in rotation 0.
+bool
+WaveshareTouchScreen::calibrateTsPoint(
+	TSPoint &p)
 {
 	bool fReturn = false;
 
@@ -803,28 +1580,6 @@ WaveshareTouchScreen::normalizeTsPoint(
 	p.y = map(p.y, tscd.yMin, tscd.yMax, 0, LCD_HEIGHT + 10);
 	if (p.y >= LCD_HEIGHT) p.y = LCD_HEIGHT - 1;
 
-	switch (rotation)
-	{
-	case 0:
-		break;
-
-	case 1:
-		swap(p.x, p.y);
-		p.y = LCD_WIDTH - 1 - p.y;
-		break;
-
-	case 2:
-		p.x = LCD_WIDTH - 1 - p.x;
-		p.y = LCD_HEIGHT - 1 - p.y;
-		break;
-
-	case 3:
-		swap(p.x, p.y);
-		p.x = LCD_HEIGHT - 1 - p.x;
-		break;
-
-	}
-
 	return fReturn;
 }
 
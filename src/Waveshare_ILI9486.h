@@ -76,6 +76,9 @@ struct TSConfigData
 };
 
 
+//  See Waveshare_ILI9486_TouchTrace.h
+class Waveshare_ILI9486_TouchTrace;
+
 //  Code compatible with the Adafruit 'Touchscreen' class, but now it's an Interface.
 class WaveshareTouchScreen
 {
@@ -103,8 +106,93 @@ public:
 
 	bool normalizeTsPoint(TSPoint &p, uint8_t rotation);
 
+	//  'normalizeTsPoint()' in two halves.  The first calibrates and maps the raw point
+	//  to rotation 0 screen co-ordinates, the second turns that into the given rotation.
+	//  The rotation is inline, so a constant one folds away.
+	bool calibrateTsPoint(TSPoint &p);
+	static void rotateTsPoint(TSPoint &p, uint8_t rotation)
+	{
+		const int16_t x = p.x;
+
+		switch (rotation)
+		{
+		case 1:
+			p.x = p.y;
+			p.y = TS_WIDTH - 1 - x;
+			break;
+
+		case 2:
+			p.x = TS_WIDTH - 1 - x;
+			p.y = TS_HEIGHT - 1 - p.y;
+			break;
+
+		case 3:
+			p.x = TS_HEIGHT - 1 - p.y;
+			p.y = x;
+			break;
+		}
+	}
+
+	//  Screen size in rotation 0.
+	static constexpr int16_t TS_WIDTH = 320;
+	static constexpr int16_t TS_HEIGHT = 480;
+
+	//  Records or replays raw readings, see Waveshare_ILI9486_TouchTrace.h.  Pass
+	//  nullptr to detach.
+	void attachTouchTrace(Waveshare_ILI9486_TouchTrace *pTrace);
+};
+
+
+
+//  Directions for 'fillRectGradient()'.  Diagonal runs from the top left corner to the
+//  bottom right.
+enum WaveshareGradientDirection : uint8_t
+{
+	GRADIENT_HORIZONTAL,
+	GRADIENT_VERTICAL,
+	GRADIENT_DIAGONAL
+};
+
+
+//  Transforms for 'drawColorsTransformed()'.  Rotations are clockwise.  MIRROR_X
+//  flips left to right, MIRROR_Y top to bottom.
+enum WaveshareTransform : uint8_t
+{
+	TRANSFORM_NONE,
+	TRANSFORM_ROTATE_90,
+	TRANSFORM_ROTATE_180,
+	TRANSFORM_ROTATE_270,
+	TRANSFORM_MIRROR_X,
+	TRANSFORM_MIRROR_Y
+};
+
+
+//  Polygon vertex, for 'fillPolygon()' and friends.
+struct WavesharePoint
+{
+	int16_t x, y;
+};
+
+//  Which parts of a self intersecting polygon are inside.  Even-odd leaves holes where
+//  the outline crosses itself (a pentagram's centre), non-zero fills them.
+enum WaveshareFillRule : uint8_t
+{
+	FILL_EVEN_ODD,
+	FILL_NON_ZERO
 };
 
+//  Ends of a thick line.  Square caps stick out by half the width, round caps are a
+//  half disc of the same size.
+enum WaveshareLineCap : uint8_t
+{
+	CAP_BUTT,
+	CAP_SQUARE,
+	CAP_ROUND
+};
+
+
+//  See Waveshare_ILI9486_Shadow.h
+class Waveshare_ILI9486_Shadow;
 
 
 //  Straight hardware access.
@@ -114,11 +202,51 @@ namespace Waveshare_ILI9486_Impl
 
 	void startWrite();
 
-	void initializeLcd();
+	//  'clearScreen' FALSE leaves GRAM as it is - see 'begin()'.
+	void initializeLcd(bool clearScreen);
 
 	void writeFillRect2(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	//  Separate pixels, one color each or all 'color' if 'pColors' is nullptr.
+	void writePixels(const WavesharePoint *pPoints, const uint16_t *pColors, uint16_t color,
+		uint16_t count, int16_t originX, int16_t originY,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
 	void writeColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors);
+	//  'stride' is the distance between source rows, in pixels.
+	void writeColorsRegion(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride);
+	//  (x, y, w, h) is the part to draw, (xOffset, yOffset) is where that is inside the
+	//  full gradient of size (fullW, fullH).
+	void writeGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color0, uint16_t color1, uint8_t direction,
+		int16_t xOffset, int16_t yOffset, int16_t fullW, int16_t fullH);
+	void writePattern(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pTile, uint8_t tileW, uint8_t tileH);
+	//  1 bit per pixel, MSB first, 'stride' bytes per row (Adafruit / GFXcanvas1
+	//  layout).  Starts 'srcX' pixels into each row.  Set bits are 'color', clear bits
+	//  are 'bg'.
+	void writeMonoBitmap(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pBits, int16_t stride, int16_t srcX, uint16_t color, uint16_t bg);
+	//  Sources in PROGMEM.
+	void writeColorsProgmem(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride);
+	void writeGrayscaleProgmem(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pGray, int16_t stride);
+	//  'stride' is in pixels.  With 'blend' FALSE the alpha channel is ignored.
+	void writeRGB888(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint8_t *pRGB, int16_t stride);
+	void writeARGB8888(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint32_t *pARGB, int16_t stride, bool blend, uint16_t bg);
+	//  (x, y, w, h) is the part to draw, (xOffset, yOffset) is where that is inside the
+	//  transformed 'srcW' x 'srcH' image.
+	void writeColorsTransformed(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t srcW, int16_t srcH, uint8_t transform,
+		int16_t xOffset, int16_t yOffset);
 	void endWrite();
+	//  Nesting count of holds.  While it's non-zero 'endWrite()' leaves the bus open.
+	void beginBusHold();
+	void endBusHold();
+	//  Closes the LCD's transaction now, even inside a hold.
+	void yieldBus();
 	void setRotation(uint8_t r);
 
 	void invertDisplay(boolean i);
@@ -126,10 +254,57 @@ namespace Waveshare_ILI9486_Impl
 
 	void setScreenBrightness(uint8_t brightness);
 	unsigned int GetSdCardCS();
+#ifdef WAVESHARE_ILI9486_HOST
+	//  Bytes 'sent' so far, in host builds - see Waveshare_ILI9486_Transport.h.
+	uint32_t hostBytesWritten();
+#endif
+
+	//  Pass nullptr to detach.
+	void setShadow(Waveshare_ILI9486_Shadow *pShadow);
+	//  Reads 'w' pixels of one row from the shadow, in screen co-ordinates.  Returns
+	//  FALSE if there is no (valid) shadow attached.
+	bool readPixels(int16_t x, int16_t y, int16_t w, uint16_t *pColors);
+
+	//  Rasterizers, in Waveshare_ILI9486_Geometry.cpp.  Output is clipped to the clip
+	//  rectangle, which must be on screen.  Polygon points are moved by the origin.
+	void fillPolygon(const WavesharePoint *pPoints, uint16_t count, uint8_t rule, uint16_t color,
+		int16_t originX, int16_t originY, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
+	void fillThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint8_t cap,
+		uint16_t color, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
+	void fillArc(int16_t x, int16_t y, int16_t innerRadius, int16_t outerRadius,
+		int16_t startAngle, int16_t endAngle, uint16_t color,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
+	void fillNeedle(int16_t x, int16_t y, int16_t length, uint8_t width, int16_t angle,
+		uint16_t color, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
+	void moveNeedle(int16_t x, int16_t y, int16_t length, uint8_t width,
+		int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bg,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH);
 
 };
 
-template<class Baseclass>
+//  Holds the bus for the rest of the scope - see 'beginBusHold()'.
+//
+//  {
+//      Waveshare_ILI9486_BusHold hold;
+//      for (...) tft.drawFastHLine(...);
+//  }
+class Waveshare_ILI9486_BusHold
+{
+public:
+	Waveshare_ILI9486_BusHold() { Waveshare_ILI9486_Impl::beginBusHold(); }
+	~Waveshare_ILI9486_BusHold() { Waveshare_ILI9486_Impl::endBusHold(); }
+
+	//  Lets something else at the bus, for example the SD card.
+	void yield() { Waveshare_ILI9486_Impl::yieldBus(); }
+
+	Waveshare_ILI9486_BusHold(const Waveshare_ILI9486_BusHold &) = delete;
+	Waveshare_ILI9486_BusHold &operator=(const Waveshare_ILI9486_BusHold &) = delete;
+};
+
+//  FIXED_ROTATION of 0 - 3 makes the rotation a compile time constant, for displays that
+//  are mounted one way for good - see Waveshare_ILI9486_Fixed below.  -1 is the usual
+//  'setRotation()' at run time.
+template<class Baseclass, int8_t FIXED_ROTATION = -1>
 class Waveshare_ILI9486_Template : public Baseclass, public WaveshareTouchScreen
 {
 public:
@@ -141,6 +316,12 @@ public:
 	//  Set initial brightness
 	bool begin(uint8_t brightness);
 
+	//  Clearing the screen is most of the start up time.  With 'clearScreen' FALSE the
+	//  panel shows whatever was left in its memory, so pass 0 for 'brightness', draw the
+	//  first frame (which can be the clear), then turn the backlight on with
+	//  'setScreenBrightness()'.
+	bool begin(uint8_t brightness, bool clearScreen);
+
 	//  Use this for SD card support.
 	static uint8_t GetSdCardCS();
 
@@ -155,9 +336,24 @@ public:
 	virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
 	virtual void endWrite(void);
 
+	using Baseclass::drawRGBBitmap;
 	virtual void drawRGBBitmap(int16_t x, int16_t y, uint16_t *bitmap, int16_t w,
 		int16_t h);
 
+	//  PROGMEM images, streamed straight from flash into one window (one per run of set
+	//  mask bits).  The mask is 1 bit per pixel, rows padded to a whole byte.
+	void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+	void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], const uint8_t mask[],
+		int16_t w, int16_t h);
+	using Baseclass::drawGrayscaleBitmap;
+	void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h);
+
+	//  Opaque 1 bit bitmap (text, icons) in a single window, instead of a pixel at a time.
+	using Baseclass::drawBitmap;
+	void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+		uint16_t color, uint16_t bg);
+
+	//  With a FIXED_ROTATION, 'r' is ignored and the fixed rotation set again.
 	virtual void setRotation(uint8_t r);
 	virtual void invertDisplay(boolean i);
 
@@ -168,13 +364,122 @@ public:
 		fillScreen(uint16_t color);
 	void drawColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors);
 
+	//  Draws the (srcX, srcY, w, h) part of a larger image - a sprite sheet or font
+	//  atlas - whose rows are 'srcStride' pixels apart.  Clipped to the screen, and
+	//  streamed straight from the source in one window.
+	void drawColorsRegion(int16_t dstX, int16_t dstY, const uint16_t *pSrc, int16_t srcStride,
+		int16_t srcX, int16_t srcY, int16_t w, int16_t h);
+
+	//  Lots of separate pixels - scatter plots, point clouds, outlines.  They're sorted
+	//  into rows, neighbours on a row go out as one run, and runs that carry on where the
+	//  last one stopped (like a vertical line of points) skip the window setup.  Where
+	//  points land on the same pixel, the later one wins.  Uses 2 bytes of heap per
+	//  point, plus 2 per screen row, while drawing.
+	void drawPixels(const WavesharePoint *pPoints, const uint16_t *pColors, uint16_t count);
+	void drawPixels(const WavesharePoint *pPoints, uint16_t count, uint16_t color);
+
+	//  Filled polygon, convex or not, closed back to the first point.  Pixels whose
+	//  centres are inside are filled, so polygons sharing an edge don't overlap.  Each
+	//  row is sent as horizontal spans, and rows with the same spans are merged into
+	//  rectangles.  Uses about 42 bytes of heap per point while drawing.
+	void fillPolygon(const WavesharePoint *pPoints, uint16_t count, uint16_t color,
+		WaveshareFillRule rule = FILL_NON_ZERO);
+	void drawPolygon(const WavesharePoint *pPoints, uint16_t count, uint16_t color);
+
+	//  Line 'width' pixels wide, between pixel centres.  Worked out in 1/16th pixels, so
+	//  a line that moves a little changes a little, and sent as spans like 'fillPolygon()'.
+	void fillThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+		uint16_t color, WaveshareLineCap cap = CAP_BUTT);
+
+	//  Ring segment around (x, y), for dials and progress rings.  Angles are in degrees,
+	//  0 is 3 o'clock and they go clockwise, from 'startAngle' round to 'endAngle'.  A
+	//  difference of 360 or more is the whole ring.  Pixels from 'innerRadius' to
+	//  'outerRadius' are filled - an 'innerRadius' of 0 gives a pie slice.
+	void fillArc(int16_t x, int16_t y, int16_t innerRadius, int16_t outerRadius,
+		int16_t startAngle, int16_t endAngle, uint16_t color);
+
+	//  Gauge needle - a round capped line from the hub at (x, y), 'length' pixels long,
+	//  pointing at 'angle' (as for 'fillArc()').
+	void drawNeedle(int16_t x, int16_t y, int16_t length, uint8_t width, int16_t angle, uint16_t color);
+	//  Moves a needle drawn by 'drawNeedle()' from 'oldAngle' to 'newAngle'.  Only the
+	//  pixels that change are sent - the old needle minus the new is filled with 'bg',
+	//  the new minus the old with 'color' - so it doesn't flicker.  The needle has to
+	//  be over a plain 'bg' background, anything else under it is lost.
+	void moveNeedle(int16_t x, int16_t y, int16_t length, uint8_t width,
+		int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bg);
+
+	//  Rotated or mirrored copy of a 'w' x 'h' image, with its top left corner at (x, y).
+	//  The 90 and 270 rotations are 'h' wide and 'w' high on screen.  The panel's own
+	//  address counters do the work, by reprogramming memory access control for the
+	//  one blit, so it costs the same as 'drawColors()'.
+	void drawColorsTransformed(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, WaveshareTransform transform);
+
+	//  24 and 32 bit images, converted to RGB565 on the way out - no converted copy is
+	//  made.  RGB888 is 3 bytes a pixel, in R, G, B order.  ARGB8888 is 0xAARRGGBB; the
+	//  first version ignores alpha, the second blends each pixel over 'bg'.
+	void drawRGB888(int16_t x, int16_t y, const uint8_t *pRGB, int16_t w, int16_t h);
+	void drawARGB8888(int16_t x, int16_t y, const uint32_t *pARGB, int16_t w, int16_t h);
+	void drawARGB8888(int16_t x, int16_t y, const uint32_t *pARGB, int16_t w, int16_t h,
+		uint16_t bg);
+
+	//  Gradient from 'color0' to 'color1', streamed straight to the panel in one window.
+	void fillRectGradient(int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color0, uint16_t color1, WaveshareGradientDirection direction);
+
+	//  Tiles the rectangle with a small pattern - hatching, checkerboards, etc.  The
+	//  tile is 'tileW' x 'tileH' pixels, row by row, and is anchored to the screen
+	//  origin so that neighbouring fills line up.  'tileW' can be at most
+	//  MAX_PATTERN_WIDTH.  A 2 x 2 tile of {A, B, B, A} is a checkerboard.
+	void fillRectPattern(int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pTile, uint8_t tileW, uint8_t tileH);
+	static constexpr uint8_t MAX_PATTERN_WIDTH = 32;
+
 	//  Non Adafruit GFX APIs
+	//  Every primitive opens and closes an SPI transaction, and toggles chip select.
+	//  Inside a bus hold that happens once, however many primitives are drawn.  Holds
+	//  nest.  Touch reads take the bus back on their own; anything else sharing the SPI
+	//  bus, like the SD card, needs 'yieldBus()' first.  Waveshare_ILI9486_BusHold does
+	//  this for a scope.
+	//  A hold belongs to one context - begin and end it from the same task, and don't
+	//  draw from two tasks at once.  On ESP32, touch reads and 'yieldBus()' only release
+	//  a bus the calling task opened; otherwise they wait for the SPI lock.
+	void beginBusHold() { Waveshare_ILI9486_Impl::beginBusHold(); }
+	void endBusHold() { Waveshare_ILI9486_Impl::endBusHold(); }
+	void yieldBus() { Waveshare_ILI9486_Impl::yieldBus(); }
+
+	//  Viewports for widgets.  'pushClip()' limits drawing to the rectangle, on top of
+	//  whatever clip is already in place, and with 'translate' TRUE also moves the
+	//  origin to its top left corner.  Everything that draws is clipped (once per
+	//  rectangle or span, not per pixel), and anything entirely outside is dropped before
+	//  touching the bus.  'fillScreen()' fills just the clip.  Clips nest up to
+	//  MAX_CLIP_DEPTH deep; 'pushClip()' returns FALSE, and changes nothing, past that.
+	//  'setRotation()' clears them.
+	bool pushClip(int16_t x, int16_t y, int16_t w, int16_t h, bool translate = false);
+	void popClip();
+	static constexpr uint8_t MAX_CLIP_DEPTH = 8;
+
 	void setScreenBrightness(uint8_t);
 	//  'Idle mode' is 8 color display mode.
 	void setIdleMode(bool i);
 
-	//  Guess who doesn't provide read access to their LCD?
-	//  uint16_t readPixel(int16_t x, int16_t y);
+	//  Guess who doesn't provide read access to their LCD?  These need a
+	//  Waveshare_ILI9486_Shadow attached, which keeps a compressed copy of the screen.
+	//  Attach it right after 'begin()', or call its 'reset()' with the current screen
+	//  color.  Without one, pixels read as 0 and copies do nothing.
+	void attachShadow(Waveshare_ILI9486_Shadow *pShadow);
+	uint16_t readPixel(int16_t x, int16_t y);
+
+	//  Reads the rectangle into 'pColors' (w * h pixels), to put back later with
+	//  'restoreRect()'.  Returns FALSE if there is no shadow.
+	bool saveRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors);
+	void restoreRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors);
+
+	//  Copies screen contents, overlapping is fine.  'moveRect()' also fills the part
+	//  of the source left uncovered with 'color'.
+	void copyRect(int16_t srcX, int16_t srcY, int16_t w, int16_t h, int16_t dstX, int16_t dstY);
+	void moveRect(int16_t srcX, int16_t srcY, int16_t w, int16_t h, int16_t dstX, int16_t dstY,
+		uint16_t color);
 
 	//  Convert the TsPoint to current screen co-ordinates.  This will also calibrate the
 	//  screen as it goes.  To calibrate the screen, just run the stylus off each of the
@@ -187,6 +492,35 @@ public:
 	//  constants are needed.
 	static constexpr int16_t LCD_WIDTH = 320;
 	static constexpr int16_t LCD_HEIGHT = 480;
+
+	//  Screen size in the FIXED_ROTATION - only meaningful if there is one.
+	static constexpr int16_t FIXED_WIDTH = (FIXED_ROTATION & 1) ? LCD_HEIGHT : LCD_WIDTH;
+	static constexpr int16_t FIXED_HEIGHT = (FIXED_ROTATION & 1) ? LCD_WIDTH : LCD_HEIGHT;
+
+private:
+	//  Screen size, constant with a FIXED_ROTATION.
+	int16_t screenWidth() const { return (FIXED_ROTATION >= 0) ? FIXED_WIDTH : Baseclass::width(); }
+	int16_t screenHeight() const { return (FIXED_ROTATION >= 0) ? FIXED_HEIGHT : Baseclass::height(); }
+
+	//  TRUE if nothing is on the clip stack and the rotation is fixed, so the clip is
+	//  the whole screen, at constant co-ordinates.  Always FALSE without a FIXED_ROTATION.
+	bool screenClip() const { return (FIXED_ROTATION >= 0) && (_clipDepth == 0); }
+
+	//  Moves the rectangle to the current origin and clips it.  (dx, dy) is how much was
+	//  cut off the left and top, for callers drawing from a source image.  Returns FALSE
+	//  if nothing is left.
+	bool clipRect(int16_t &x, int16_t &y, int16_t &w, int16_t &h, int16_t &dx, int16_t &dy);
+	void resetClip();
+
+	//  The clip in screen co-ordinates, and where (0, 0) is.
+	struct Clip
+	{
+		int16_t x, y, w, h;
+		int16_t originX, originY;
+	};
+	Clip _clip;
+	Clip _clipStack[MAX_CLIP_DEPTH];
+	uint8_t _clipDepth;
 };
 
 
@@ -195,46 +529,70 @@ public:
 //  paramenter instead, and have access to all your enhancements.
 typedef Waveshare_ILI9486_Template<Adafruit_GFX> Waveshare_ILI9486;
 
+//  For displays that never change orientation.  The screen size, clipping to the
+//  screen and the touch point rotation all fold down to constants, and MADCTL is set
+//  once, by 'begin()'.
+//
+//      Waveshare_ILI9486_Fixed<1> Waveshield;     //  Landscape, 480 x 320.
+template<uint8_t ROTATION>
+using Waveshare_ILI9486_Fixed = Waveshare_ILI9486_Template<Adafruit_GFX, ROTATION>;
+
 
 ////  Template implementation follows
-template<class Baseclass>
-Waveshare_ILI9486_Template<Baseclass>::Waveshare_ILI9486_Template()
+template<class Baseclass, int8_t FIXED_ROTATION>
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::Waveshare_ILI9486_Template()
 	:Baseclass(LCD_WIDTH, LCD_HEIGHT)
 {
+	static_assert(FIXED_ROTATION < 4, "FIXED_ROTATION is 0 - 3, or -1 for none");
+
+	if (FIXED_ROTATION >= 0)
+	{
+		//  Just the GFX side - the panel isn't up yet.
+		Baseclass::setRotation(FIXED_ROTATION);
+	}
 	Waveshare_ILI9486_Impl::initializePins();
+	resetClip();
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 bool
-Waveshare_ILI9486_Template<Baseclass>::begin()
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::begin()
 {
 	return begin(0xff);
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
+bool
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::begin(uint8_t brightness)
+{
+	return begin(brightness, true);
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
 bool
-Waveshare_ILI9486_Template<Baseclass>::begin(uint8_t brightness)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::begin(uint8_t brightness, bool clearScreen)
 {
+	//  Again - some cores reset the pins between static constructors and 'setup()'.
 	Waveshare_ILI9486_Impl::initializePins();
 
-	Waveshare_ILI9486_Impl::initializeLcd();
-	setRotation(0);
+	Waveshare_ILI9486_Impl::initializeLcd(clearScreen);
+	setRotation((FIXED_ROTATION >= 0) ? FIXED_ROTATION : 0);
 	setScreenBrightness(brightness);
 	return true;
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 uint8_t
-Waveshare_ILI9486_Template<Baseclass>::GetSdCardCS()
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::GetSdCardCS()
 {
 	return Waveshare_ILI9486_Impl::GetSdCardCS();
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::drawPixel(
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawPixel(
 	int16_t x, int16_t y, uint16_t color)
 {
 	startWrite();
@@ -245,32 +603,44 @@ Waveshare_ILI9486_Template<Baseclass>::drawPixel(
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::startWrite()
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::startWrite()
 {
 	Waveshare_ILI9486_Impl::startWrite();
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::writePixel(
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::writePixel(
 	int16_t x, int16_t y, uint16_t color)
 {
-	if (x < 0) return;
-	if (y < 0) return;
+	if (screenClip())
+	{
+		if ((uint16_t)x >= (uint16_t)FIXED_WIDTH) return;
+		if ((uint16_t)y >= (uint16_t)FIXED_HEIGHT) return;
+
+		Waveshare_ILI9486_Impl::writeFillRect2(x, y, 1, 1, color);
+		return;
+	}
 
-	if (x >= Baseclass::width()) return;
-	if (y >= Baseclass::height()) return;
+	x += _clip.originX;
+	y += _clip.originY;
+
+	if (x < _clip.x) return;
+	if (y < _clip.y) return;
+
+	if (x >= _clip.x + _clip.w) return;
+	if (y >= _clip.y + _clip.h) return;
 
 	Waveshare_ILI9486_Impl::writeFillRect2(x, y, 1, 1, color);
 }
 
 void TestSkip();
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
 	//  Negative widths, so swap left and right sides
 	if (w < 0)
@@ -286,66 +656,141 @@ Waveshare_ILI9486_Template<Baseclass>::writeFillRect(int16_t x, int16_t y, int16
 		y -= h;
 	}
 
-	// Left side offscreen, clip
-	if (x < 0)
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	// Now, 0 <= clip x <= x <= x+w <= clip x+w <= WIDTH
+	// And, 0 <= clip y <= y <= y+h <= clip y+h <= HEIGHT
+	Waveshare_ILI9486_Impl::writeFillRect2(x, y, w, h, color);
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+bool
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::clipRect(
+	int16_t &x, int16_t &y, int16_t &w, int16_t &h, int16_t &dx, int16_t &dy)
+{
+	//  With a fixed rotation and no clip pushed, these are all constants.
+	const bool screen = screenClip();
+	const int16_t clipX = screen ? 0 : _clip.x;
+	const int16_t clipY = screen ? 0 : _clip.y;
+	const int16_t clipW = screen ? FIXED_WIDTH : _clip.w;
+	const int16_t clipH = screen ? FIXED_HEIGHT : _clip.h;
+
+	if (!screen)
+	{
+		x += _clip.originX;
+		y += _clip.originY;
+	}
+	dx = dy = 0;
+
+	// Left side outside the clip, clip
+	if (x < clipX)
 	{
-		w += x;
-		x = 0;
+		dx = clipX - x;
+		w -= dx;
+		x = clipX;
 	}
 
-	// Top offscreen, clip
-	if (y < 0)
+	// Top outside the clip, clip
+	if (y < clipY)
 	{
-		h += y;
-		y = 0;
+		dy = clipY - y;
+		h -= dy;
+		y = clipY;
 	}
 
-	//  Rightside offscreen, clip
-	if (x + w > Baseclass::width())
+	//  Rightside outside the clip, clip
+	if (x + w > clipX + clipW)
 	{
-		w = Baseclass::width() - x;
+		w = clipX + clipW - x;
 	}
 
-	// bottom offscreen, clip
-	if (y + h > Baseclass::height())
+	// bottom outside the clip, clip
+	if (y + h > clipY + clipH)
 	{
-		h = Baseclass::height() - y;
+		h = clipY + clipH - y;
 	}
 
-	//  Entire width or entire height is offscreen
-	if (w <= 0) return;
-	if (h <= 0) return;
+	//  Entire width or entire height is outside
+	return (w > 0) && (h > 0);
+}
 
-	// Now, 0 <= x <= x+w <= WIDTH
-	// And, 0 <= y <= y+h <= HEIGHT
-	Waveshare_ILI9486_Impl::writeFillRect2(x, y, w, h, color);
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::resetClip()
+{
+	_clip.x = _clip.y = 0;
+	_clip.w = screenWidth();
+	_clip.h = screenHeight();
+	_clip.originX = _clip.originY = 0;
+	_clipDepth = 0;
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+bool
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::pushClip(int16_t x, int16_t y, int16_t w, int16_t h, bool translate)
+{
+	if (_clipDepth == MAX_CLIP_DEPTH) return false;
+
+	_clipStack[_clipDepth++] = _clip;
+
+	//  The new origin is the corner before clipping, so a widget half off screen still
+	//  draws in the right place.
+	const int16_t originX = x + _clip.originX;
+	const int16_t originY = y + _clip.originY;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy))
+	{
+		//  Nothing visible - everything inside is dropped.
+		w = h = 0;
+	}
+	_clip.x = x;
+	_clip.y = y;
+	_clip.w = w;
+	_clip.h = h;
+	if (translate)
+	{
+		_clip.originX = originX;
+		_clip.originY = originY;
+	}
+	return true;
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::popClip()
+{
+	if (_clipDepth > 0)
+	{
+		_clip = _clipStack[--_clipDepth];
+	}
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
 	writeFillRect(x, y, 1, h, color);
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
 	writeFillRect(x, y, w, 1, color);
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::endWrite()
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::endWrite()
 {
 	Waveshare_ILI9486_Impl::endWrite();
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::drawRGBBitmap(
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawRGBBitmap(
 	int16_t x, int16_t y,
 	uint16_t *bitmap,
 	int16_t w, int16_t h)
@@ -354,34 +799,129 @@ Waveshare_ILI9486_Template<Baseclass>::drawRGBBitmap(
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawRGBBitmap(
+	int16_t x, int16_t y,
+	const uint16_t bitmap[],
+	int16_t w, int16_t h)
+{
+	const int16_t stride = w;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeColorsProgmem(x, y, w, h, bitmap + (int32_t)dy * stride + dx, stride);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawRGBBitmap(
+	int16_t x, int16_t y,
+	const uint16_t bitmap[], const uint8_t mask[],
+	int16_t w, int16_t h)
+{
+	const int16_t stride = w;
+	const int16_t maskStride = (w + 7) / 8;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	bitmap += (int32_t)dy * stride;
+	mask += (int32_t)dy * maskStride;
+
+	startWrite();
+	for (int16_t row = 0; row < h; row++, bitmap += stride, mask += maskStride)
+	{
+		//  One window per run of visible pixels.
+		int16_t col = dx;
+		while (col < dx + w)
+		{
+			while ((col < dx + w) && !(pgm_read_byte(mask + (col >> 3)) & (0x80 >> (col & 7))))
+			{
+				col++;
+			}
+			const int16_t start = col;
+			while ((col < dx + w) && (pgm_read_byte(mask + (col >> 3)) & (0x80 >> (col & 7))))
+			{
+				col++;
+			}
+			if (col > start)
+			{
+				Waveshare_ILI9486_Impl::writeColorsProgmem(x + start - dx, y + row, col - start, 1,
+					bitmap + start, stride);
+			}
+		}
+	}
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawGrayscaleBitmap(
+	int16_t x, int16_t y,
+	const uint8_t bitmap[],
+	int16_t w, int16_t h)
+{
+	const int16_t stride = w;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeGrayscaleProgmem(x, y, w, h, bitmap + (int32_t)dy * stride + dx, stride);
+	endWrite();
+}
+
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawBitmap(
+	int16_t x, int16_t y,
+	uint8_t *bitmap,
+	int16_t w, int16_t h,
+	uint16_t color, uint16_t bg)
+{
+	const int16_t stride = (w + 7) / 8;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeMonoBitmap(x, y, w, h, bitmap + dy * stride, stride, dx, color, bg);
+	endWrite();
+}
+
+
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::setRotation(uint8_t r)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::setRotation(uint8_t r)
 {
+	if (FIXED_ROTATION >= 0) r = FIXED_ROTATION;
+
 	Waveshare_ILI9486_Impl::setRotation(r);
 	//  Don't forget to tell the base class!
 	Baseclass::setRotation(r);
+	resetClip();
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::invertDisplay(boolean i)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::invertDisplay(boolean i)
 {
 	Waveshare_ILI9486_Impl::invertDisplay(i);
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
 	startWrite();
 	writeFillRect(x, y, 1, h, color);
 	endWrite();
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
 	startWrite();
 	writeFillRect(x, y, w, 1, color);
@@ -389,9 +929,9 @@ Waveshare_ILI9486_Template<Baseclass>::drawFastHLine(int16_t x, int16_t y, int16
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
 	startWrite();
 	writeFillRect(x, y, w, h, color);
@@ -399,46 +939,388 @@ Waveshare_ILI9486_Template<Baseclass>::fillRect(int16_t x, int16_t y, int16_t w,
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::fillScreen(uint16_t color)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillScreen(uint16_t color)
 {
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
 	startWrite();
-	Waveshare_ILI9486_Impl::writeFillRect2(0, 0, Baseclass::width(), Baseclass::height(), color);
+	Waveshare_ILI9486_Impl::writeFillRect2(_clip.x, _clip.y, _clip.w, _clip.h, color);
 	endWrite();
 }
 
 //  Non Adafruit_GFX APIs.
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawColors(
+	int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors)
+{
+	drawColorsRegion(x, y, pColors, w, 0, 0, w, h);
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawColorsRegion(
+	int16_t dstX, int16_t dstY, const uint16_t *pSrc, int16_t srcStride,
+	int16_t srcX, int16_t srcY, int16_t w, int16_t h)
+{
+	int16_t dx, dy;
+	if (!clipRect(dstX, dstY, w, h, dx, dy)) return;
+
+	pSrc += (int32_t)(srcY + dy) * srcStride + srcX + dx;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeColorsRegion(dstX, dstY, w, h, pSrc, srcStride);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawPixels(
+	const WavesharePoint *pPoints, const uint16_t *pColors, uint16_t count)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writePixels(pPoints, pColors, 0, count, _clip.originX, _clip.originY,
+		_clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawPixels(
+	const WavesharePoint *pPoints, uint16_t count, uint16_t color)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writePixels(pPoints, nullptr, color, count, _clip.originX, _clip.originY,
+		_clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillPolygon(
+	const WavesharePoint *pPoints, uint16_t count, uint16_t color, WaveshareFillRule rule)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::fillPolygon(pPoints, count, rule, color, _clip.originX, _clip.originY,
+		_clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawPolygon(
+	const WavesharePoint *pPoints, uint16_t count, uint16_t color)
+{
+	if (count == 0) return;
+
+	startWrite();
+	for (uint16_t i = 0; i < count; i++)
+	{
+		const WavesharePoint &a = pPoints[i];
+		const WavesharePoint &b = pPoints[(i + 1 < count) ? i + 1 : 0];
+		Baseclass::writeLine(a.x, a.y, b.x, b.y, color);
+	}
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillThickLine(
+	int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width,
+	uint16_t color, WaveshareLineCap cap)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::fillThickLine(x0 + _clip.originX, y0 + _clip.originY,
+		x1 + _clip.originX, y1 + _clip.originY, width, cap, color,
+		_clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillArc(
+	int16_t x, int16_t y, int16_t innerRadius, int16_t outerRadius,
+	int16_t startAngle, int16_t endAngle, uint16_t color)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::fillArc(x + _clip.originX, y + _clip.originY, innerRadius, outerRadius,
+		startAngle, endAngle, color, _clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawNeedle(
+	int16_t x, int16_t y, int16_t length, uint8_t width, int16_t angle, uint16_t color)
+{
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::fillNeedle(x + _clip.originX, y + _clip.originY, length, width, angle, color,
+		_clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::moveNeedle(
+	int16_t x, int16_t y, int16_t length, uint8_t width,
+	int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bg)
+{
+	if (oldAngle == newAngle) return;
+	if ((_clip.w <= 0) || (_clip.h <= 0)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::moveNeedle(x + _clip.originX, y + _clip.originY, length, width,
+		oldAngle, newAngle, color, bg, _clip.x, _clip.y, _clip.w, _clip.h);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawColorsTransformed(
+	int16_t x, int16_t y, int16_t w, int16_t h,
+	const uint16_t *pColors, WaveshareTransform transform)
+{
+	if (transform > TRANSFORM_MIRROR_Y) return;
+
+	const bool swap = (transform == TRANSFORM_ROTATE_90) || (transform == TRANSFORM_ROTATE_270);
+	int16_t outW = swap ? h : w;
+	int16_t outH = swap ? w : h;
+	int16_t dx, dy;
+	if (!clipRect(x, y, outW, outH, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeColorsTransformed(x, y, outW, outH, pColors, w, h, transform, dx, dy);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawRGB888(
+	int16_t x, int16_t y, const uint8_t *pRGB, int16_t w, int16_t h)
+{
+	const int16_t stride = w;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeRGB888(x, y, w, h, pRGB + 3 * ((int32_t)dy * stride + dx), stride);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawARGB8888(
+	int16_t x, int16_t y, const uint32_t *pARGB, int16_t w, int16_t h)
+{
+	const int16_t stride = w;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeARGB8888(x, y, w, h, pARGB + (int32_t)dy * stride + dx, stride, false, 0);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::drawARGB8888(
+	int16_t x, int16_t y, const uint32_t *pARGB, int16_t w, int16_t h, uint16_t bg)
+{
+	const int16_t stride = w;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeARGB8888(x, y, w, h, pARGB + (int32_t)dy * stride + dx, stride, true, bg);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillRectGradient(
+	int16_t x, int16_t y, int16_t w, int16_t h,
+	uint16_t color0, uint16_t color1, WaveshareGradientDirection direction)
+{
+	const int16_t fullW = w, fullH = h;
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writeGradient(x, y, w, h, color0, color1, direction, dx, dy, fullW, fullH);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::fillRectPattern(
+	int16_t x, int16_t y, int16_t w, int16_t h,
+	const uint16_t *pTile, uint8_t tileW, uint8_t tileH)
+{
+	if ((tileW == 0) || (tileH == 0) || (tileW > MAX_PATTERN_WIDTH)) return;
+
+	int16_t dx, dy;
+	if (!clipRect(x, y, w, h, dx, dy)) return;
+
+	startWrite();
+	Waveshare_ILI9486_Impl::writePattern(x, y, w, h, pTile, tileW, tileH);
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::attachShadow(Waveshare_ILI9486_Shadow *pShadow)
+{
+	Waveshare_ILI9486_Impl::setShadow(pShadow);
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+uint16_t
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::readPixel(int16_t x, int16_t y)
+{
+	uint16_t color = 0;
+	x += _clip.originX;
+	y += _clip.originY;
+	if ((x < 0) || (y < 0) || (x >= screenWidth()) || (y >= screenHeight())) return color;
+
+	Waveshare_ILI9486_Impl::readPixels(x, y, 1, &color);
+	return color;
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+bool
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::saveRect(
+	int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors)
+{
+	x += _clip.originX;
+	y += _clip.originY;
+	for (int16_t row = 0; row < h; row++)
+	{
+		if (!Waveshare_ILI9486_Impl::readPixels(x, y + row, w, pColors + (int32_t)row * w))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::drawColors(
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::restoreRect(
 	int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors)
 {
+	drawColors(x, y, w, h, pColors);
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::copyRect(
+	int16_t srcX, int16_t srcY, int16_t w, int16_t h, int16_t dstX, int16_t dstY)
+{
+	//  Only the destination needs clipping.  Off screen source pixels read as 0.
+	int16_t dx, dy;
+	if (!clipRect(dstX, dstY, w, h, dx, dy)) return;
+	srcX += _clip.originX + dx;
+	srcY += _clip.originY + dy;
+
+	//  Copy in whichever order doesn't overwrite source pixels before they're read -
+	//  rows bottom up when moving down, and chunks right to left when moving right.
+	const bool upwards = dstY > srcY;
+	const bool leftwards = (dstY == srcY) && (dstX > srcX);
+
+	constexpr int16_t CHUNK = 32;
+	uint16_t chunk[CHUNK];
+
+	startWrite();
+	for (int16_t i = 0; i < h; i++)
+	{
+		const int16_t row = upwards ? h - 1 - i : i;
+		for (int16_t done = 0; done < w; done += CHUNK)
+		{
+			const int16_t count = (w - done < CHUNK) ? w - done : CHUNK;
+			const int16_t col = leftwards ? w - done - count : done;
+
+			if (!Waveshare_ILI9486_Impl::readPixels(srcX + col, srcY + row, count, chunk))
+			{
+				endWrite();
+				return;
+			}
+			Waveshare_ILI9486_Impl::writeColors(dstX + col, dstY + row, count, 1, chunk);
+		}
+	}
+	endWrite();
+}
+
+template<class Baseclass, int8_t FIXED_ROTATION>
+void
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::moveRect(
+	int16_t srcX, int16_t srcY, int16_t w, int16_t h, int16_t dstX, int16_t dstY, uint16_t color)
+{
+	copyRect(srcX, srcY, w, h, dstX, dstY);
+
+	//  Fill source minus destination - up to two strips above / below the overlap, and
+	//  two beside it.
+	const int16_t top = (dstY > srcY) ? dstY : srcY;
+	const int16_t bottom = (dstY + h < srcY + h) ? dstY + h : srcY + h;
+	const int16_t left = (dstX > srcX) ? dstX : srcX;
+	const int16_t right = (dstX + w < srcX + w) ? dstX + w : srcX + w;
+
 	startWrite();
-	Waveshare_ILI9486_Impl::writeColors(x, y, w, h, pColors);
+	if ((top >= bottom) || (left >= right))
+	{
+		//  No overlap.
+		writeFillRect(srcX, srcY, w, h, color);
+	}
+	else
+	{
+		writeFillRect(srcX, srcY, w, top - srcY, color);
+		writeFillRect(srcX, bottom, w, srcY + h - bottom, color);
+		writeFillRect(srcX, top, left - srcX, bottom - top, color);
+		writeFillRect(right, top, srcX + w - right, bottom - top, color);
+	}
 	endWrite();
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::setScreenBrightness(uint8_t brightness)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::setScreenBrightness(uint8_t brightness)
 {
 	Waveshare_ILI9486_Impl::setScreenBrightness(brightness);
 }
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 void
-Waveshare_ILI9486_Template<Baseclass>::setIdleMode(bool idle)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::setIdleMode(bool idle)
 {
 	Waveshare_ILI9486_Impl::setIdleMode(idle);
 }
 
 
-template<class Baseclass>
+template<class Baseclass, int8_t FIXED_ROTATION>
 bool
-Waveshare_ILI9486_Template<Baseclass>::normalizeTsPoint(TSPoint &p)
+Waveshare_ILI9486_Template<Baseclass, FIXED_ROTATION>::normalizeTsPoint(TSPoint &p)
 {
-	return WaveshareTouchScreen::normalizeTsPoint(p, Baseclass::rotation);
+	if (FIXED_ROTATION < 0)
+	{
+		return WaveshareTouchScreen::normalizeTsPoint(p, Baseclass::rotation);
+	}
+
+	const bool updated = calibrateTsPoint(p);
+	rotateTsPoint(p, FIXED_ROTATION);
+	return updated;
 }
 
 #endif
@@ -0,0 +1,142 @@
+//  Waveshare ILI9486 benchmark
+//  - Repeatable timing of drawing calls, reported as CSV.
+//
+//  Each case is run a fixed number of times, after one untimed warm up, and the
+//  min, median and 95th percentile times are printed as one CSV line, with the pixel
+//  rate at the median.  Every line starts with a tag - board, build, whatever is
+//  being compared - so results from different runs can be pasted into one sheet.
+//
+//      Waveshare_ILI9486_Benchmark<> bench(Serial, "mega2560");
+//      bench.printHeader();
+//      bench.run(F("fillScreen"), 8, 320UL * 480, []() { tft.fillScreen(BLACK); });
+//
+//  Every drawing call releases the bus before returning, so its time includes all
+//  of its transfers.  'yield()' is called between runs, to keep the ESP8266 watchdog
+//  happy.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_BENCHMARK_h
+#define _WAVESHARE_ILI9486_BENCHMARK_h
+
+//  MAX_RUNS sets the storage, 4 bytes a run.  More runs than this are clamped.
+template<uint16_t MAX_RUNS = 32>
+class Waveshare_ILI9486_Benchmark
+{
+public:
+	//  Microseconds.
+	struct Result
+	{
+		uint32_t min;
+		uint32_t median;
+		uint32_t p95;
+	};
+
+	Waveshare_ILI9486_Benchmark(Print &out, const char *pTag);
+
+	//  Prints the CSV column names.
+	void printHeader();
+
+	//  Times 'function()' over 'runs' calls, prints the line and returns the times.
+	//  'pixels' is how many each call draws, for the pixel rate - 0 if that doesn't
+	//  apply.  'pName' can be a plain string or F("...").
+	template<class Name, class Function>
+	Result run(Name pName, uint16_t runs, uint32_t pixels, Function function);
+
+private:
+	Print &_out;
+	const char *_pTag;
+	uint32_t _samples[MAX_RUNS];
+};
+
+
+////  Template implementation follows
+template<uint16_t MAX_RUNS>
+Waveshare_ILI9486_Benchmark<MAX_RUNS>::Waveshare_ILI9486_Benchmark(Print &out, const char *pTag)
+	:_out(out), _pTag(pTag)
+{
+}
+
+template<uint16_t MAX_RUNS>
+void
+Waveshare_ILI9486_Benchmark<MAX_RUNS>::printHeader()
+{
+	_out.println(F("tag,case,runs,min_us,median_us,p95_us,pixels,pixels_per_s"));
+}
+
+template<uint16_t MAX_RUNS>
+template<class Name, class Function>
+typename Waveshare_ILI9486_Benchmark<MAX_RUNS>::Result
+Waveshare_ILI9486_Benchmark<MAX_RUNS>::run(Name pName, uint16_t runs, uint32_t pixels, Function function)
+{
+	if (runs > MAX_RUNS) runs = MAX_RUNS;
+	if (runs == 0) runs = 1;
+
+	function();
+	yield();
+
+	for (uint16_t i = 0; i < runs; i++)
+	{
+		const uint32_t start = micros();
+		function();
+		const uint32_t time = micros() - start;
+
+		//  Insertion sort as they come in.
+		uint16_t j = i;
+		for (; j > 0 && _samples[j - 1] > time; j--)
+		{
+			_samples[j] = _samples[j - 1];
+		}
+		_samples[j] = time;
+
+		yield();
+	}
+
+	//  Median of an even count is the mean of the middle two.  The 95th percentile is
+	//  by nearest rank.
+	Result result;
+	result.min = _samples[0];
+	result.median = ((runs & 1) != 0) ? _samples[runs / 2] :
+		(_samples[runs / 2 - 1] + _samples[runs / 2] + 1) / 2;
+	result.p95 = _samples[(uint32_t(runs) * 95 + 99) / 100 - 1];
+
+	_out.print(_pTag);
+	_out.print(',');
+	_out.print(pName);
+	_out.print(',');
+	_out.print(runs);
+	_out.print(',');
+	_out.print(result.min);
+	_out.print(',');
+	_out.print(result.median);
+	_out.print(',');
+	_out.print(result.p95);
+	_out.print(',');
+	_out.print(pixels);
+	_out.print(',');
+	_out.println((result.median != 0) ? pixels * 1000000.0 / result.median : 0.0, 0);
+
+	return result;
+}
+
+#endif
@@ -0,0 +1,451 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+
+#include "Waveshare_ILI9486.h"
+#include "Waveshare_ILI9486_Canvas8.h"
+
+
+namespace
+{
+	//  A row marked clean.
+	constexpr uint8_t CLEAN_START = 0xFF;
+	constexpr uint8_t CLEAN_END = 0x00;
+
+	//  Sets or clears the bits under 'mask'.
+	inline void apply(uint8_t &byte, uint8_t mask, bool set)
+	{
+		byte = set ? (byte | mask) : (byte & ~mask);
+	}
+
+	//  Sets or clears pixels [x, x + w) of one plane row, a byte at a time.
+	void fillSpan(uint8_t *pPlane, int16_t x, int16_t w, bool set)
+	{
+		const int16_t first = x >> 3;
+		const int16_t last = (x + w - 1) >> 3;
+		const uint8_t firstMask = 0xFF >> (x & 7);
+		const uint8_t lastMask = 0xFF << (7 - ((x + w - 1) & 7));
+
+		if (first == last)
+		{
+			apply(pPlane[first], firstMask & lastMask, set);
+			return;
+		}
+
+		apply(pPlane[first], firstMask, set);
+		if (last - first > 1)
+		{
+			memset(pPlane + first + 1, set ? 0xFF : 0x00, last - first - 1);
+		}
+		apply(pPlane[last], lastMask, set);
+	}
+
+	inline uint8_t readByte(const uint8_t *p, bool progmem)
+	{
+		return progmem ? pgm_read_byte(p) : *p;
+	}
+
+	//  The 8 bitmap bits starting at bit 's' of the row, MSB first.  's' can be
+	//  negative, for the first byte of an unaligned destination - those bits are 0.
+	inline uint8_t sourceBits(const uint8_t *pRow, int16_t s, int16_t rowBytes, bool progmem)
+	{
+		if (s < 0) return readByte(pRow, progmem) >> (-s);
+
+		const int16_t index = s >> 3;
+		const uint8_t shift = s & 7;
+		uint8_t bits = readByte(pRow + index, progmem) << shift;
+		if ((shift != 0) && (index + 1 < rowBytes))
+		{
+			bits |= readByte(pRow + index + 1, progmem) >> (8 - shift);
+		}
+		return bits;
+	}
+}
+
+
+Waveshare_ILI9486_Canvas8::Waveshare_ILI9486_Canvas8(int16_t w, int16_t h)
+	:Adafruit_GFX(w, h), _pPlanes(nullptr), _pLine(nullptr),
+	_pDirtyStart(nullptr), _pDirtyEnd(nullptr), _stride((w + 7) / 8)
+{
+}
+
+Waveshare_ILI9486_Canvas8::~Waveshare_ILI9486_Canvas8()
+{
+	free(_pPlanes);
+	free(_pLine);
+	free(_pDirtyStart);
+}
+
+bool
+Waveshare_ILI9486_Canvas8::begin()
+{
+	if (_pPlanes != nullptr)
+	{
+		return true;
+	}
+
+	const size_t bytes = (size_t)3 * _stride * HEIGHT;
+	_pPlanes = (uint8_t *)malloc(bytes);
+	_pLine = (uint16_t *)malloc((size_t)_stride * 8 * sizeof(uint16_t));
+	_pDirtyStart = (uint8_t *)malloc(2 * (size_t)HEIGHT);
+	if ((_pPlanes == nullptr) || (_pLine == nullptr) || (_pDirtyStart == nullptr))
+	{
+		free(_pPlanes);
+		free(_pLine);
+		free(_pDirtyStart);
+		_pPlanes = nullptr;
+		_pLine = nullptr;
+		_pDirtyStart = nullptr;
+		return false;
+	}
+	_pDirtyEnd = _pDirtyStart + HEIGHT;
+
+	memset(_pPlanes, 0, bytes);
+	invalidate();
+	return true;
+}
+
+uint16_t
+Waveshare_ILI9486_Canvas8::toColor(uint8_t index)
+{
+	return ((index & 4) ? 0xF800 : 0) | ((index & 2) ? 0x07E0 : 0) | ((index & 1) ? 0x001F : 0);
+}
+
+uint8_t
+Waveshare_ILI9486_Canvas8::toIndex(uint16_t color)
+{
+	//  The top bit of each of red, green and blue.
+	return ((color >> 13) & 4) | ((color >> 9) & 2) | ((color >> 4) & 1);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+	fillRect(x, y, 1, 1, color);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+	fillRect(x, y, 1, h, color);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+	fillRect(x, y, w, 1, color);
+}
+
+void
+Waveshare_ILI9486_Canvas8::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	if (_pPlanes == nullptr) return;
+	if (!toBuffer(x, y, w, h)) return;
+
+	fillBufferRect(x, y, w, h, toIndex(color));
+}
+
+void
+Waveshare_ILI9486_Canvas8::fillScreen(uint16_t color)
+{
+	fillRect(0, 0, _width, _height, color);
+}
+
+bool
+Waveshare_ILI9486_Canvas8::toBuffer(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const
+{
+	if (w < 0)
+	{
+		w = -w;
+		x -= w;
+	}
+	if (h < 0)
+	{
+		h = -h;
+		y -= h;
+	}
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (x + w > _width) w = _width - x;
+	if (y + h > _height) h = _height - y;
+	if ((w <= 0) || (h <= 0)) return false;
+
+	//  Same orientation handling as GFXcanvas16 - the buffer is always in rotation(0).
+	int16_t t;
+	switch (rotation)
+	{
+	case 1:
+		t = x;
+		x = WIDTH - y - h;
+		y = t;
+		t = w;
+		w = h;
+		h = t;
+		break;
+
+	case 2:
+		x = WIDTH - x - w;
+		y = HEIGHT - y - h;
+		break;
+
+	case 3:
+		t = y;
+		y = HEIGHT - x - w;
+		x = t;
+		t = w;
+		w = h;
+		h = t;
+		break;
+	}
+	return true;
+}
+
+void
+Waveshare_ILI9486_Canvas8::fillBufferRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index)
+{
+	markDirty(y, h, x, w);
+
+	for (int16_t i = 0; i < h; i++)
+	{
+		uint8_t *pPlane = row(y + i);
+
+		//  Red, green, blue.
+		for (uint8_t bit = 4; bit != 0; bit >>= 1, pPlane += _stride)
+		{
+			fillSpan(pPlane, x, w, (index & bit) != 0);
+		}
+	}
+}
+
+void
+Waveshare_ILI9486_Canvas8::markDirty(int16_t y, int16_t h, int16_t x, int16_t w)
+{
+	const uint8_t start = x >> 3;
+	const uint8_t end = ((x + w - 1) >> 3) + 1;
+
+	for (int16_t i = y; i < y + h; i++)
+	{
+		if (start < _pDirtyStart[i]) _pDirtyStart[i] = start;
+		if (end > _pDirtyEnd[i]) _pDirtyEnd[i] = end;
+	}
+}
+
+void
+Waveshare_ILI9486_Canvas8::invalidate()
+{
+	if (_pDirtyStart == nullptr) return;
+
+	memset(_pDirtyStart, 0, HEIGHT);
+	memset(_pDirtyEnd, _stride, HEIGHT);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+	uint16_t color)
+{
+	drawBits(x, y, bitmap, w, h, color, 0, false, true);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+	uint16_t color, uint16_t bg)
+{
+	drawBits(x, y, bitmap, w, h, color, bg, true, true);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+	uint16_t color)
+{
+	drawBits(x, y, bitmap, w, h, color, 0, false, false);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+	uint16_t color, uint16_t bg)
+{
+	drawBits(x, y, bitmap, w, h, color, bg, true, false);
+}
+
+void
+Waveshare_ILI9486_Canvas8::drawBits(
+	int16_t x, int16_t y,
+	const uint8_t *pBitmap,
+	int16_t w, int16_t h,
+	uint16_t color, uint16_t bg,
+	bool opaque,
+	bool progmem)
+{
+	if ((_pPlanes == nullptr) || (w <= 0) || (h <= 0)) return;
+
+	const int16_t rowBytes = (w + 7) / 8;
+
+	if (rotation != 0)
+	{
+		//  The buffer runs a different way to the bitmap - a pixel at a time.
+		for (int16_t j = 0; j < h; j++)
+		{
+			const uint8_t *pRow = pBitmap + (int32_t)j * rowBytes;
+			for (int16_t i = 0; i < w; i++)
+			{
+				if (readByte(pRow + (i >> 3), progmem) & (0x80 >> (i & 7)))
+				{
+					drawPixel(x + i, y + j, color);
+				}
+				else if (opaque)
+				{
+					drawPixel(x + i, y + j, bg);
+				}
+			}
+		}
+		return;
+	}
+
+	//  Clip, keeping track of where in the bitmap the visible part starts.
+	int16_t srcX = 0;
+	int16_t srcY = 0;
+	if (x < 0)
+	{
+		srcX = -x;
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		srcY = -y;
+		h += y;
+		y = 0;
+	}
+	if (x + w > _width) w = _width - x;
+	if (y + h > _height) h = _height - y;
+	if ((w <= 0) || (h <= 0)) return;
+
+	markDirty(y, h, x, w);
+
+	const uint8_t fg = toIndex(color);
+	const uint8_t back = toIndex(bg);
+	const int16_t first = x >> 3;
+	const int16_t last = (x + w - 1) >> 3;
+
+	for (int16_t j = 0; j < h; j++)
+	{
+		const uint8_t *pRow = pBitmap + (int32_t)(srcY + j) * rowBytes;
+		uint8_t *pPlanes = row(y + j);
+
+		for (int16_t b = first; b <= last; b++)
+		{
+			//  The pixels of this byte inside [x, x + w), and the bitmap bits for them.
+			uint8_t mask = 0xFF;
+			if (b == first) mask &= 0xFF >> (x & 7);
+			if (b == last) mask &= 0xFF << (7 - ((x + w - 1) & 7));
+			const uint8_t bits = sourceBits(pRow, srcX + b * 8 - x, rowBytes, progmem);
+
+			uint8_t *pByte = pPlanes + b;
+			for (uint8_t bit = 4; bit != 0; bit >>= 1, pByte += _stride)
+			{
+				if (opaque)
+				{
+					const uint8_t value = ((fg & bit) ? bits : 0) | ((back & bit) ? ~bits : 0);
+					*pByte = (*pByte & ~mask) | (value & mask);
+				}
+				else
+				{
+					apply(*pByte, bits & mask, (fg & bit) != 0);
+				}
+			}
+		}
+	}
+}
+
+uint16_t
+Waveshare_ILI9486_Canvas8::getPixel(int16_t x, int16_t y) const
+{
+	int16_t w = 1;
+	int16_t h = 1;
+	if ((_pPlanes == nullptr) || !toBuffer(x, y, w, h)) return 0;
+
+	const uint8_t *pPlane = row(y) + (x >> 3);
+	const uint8_t mask = 0x80 >> (x & 7);
+	uint8_t index = 0;
+	for (uint8_t bit = 4; bit != 0; bit >>= 1, pPlane += _stride)
+	{
+		if (*pPlane & mask) index |= bit;
+	}
+	return toColor(index);
+}
+
+uint32_t
+Waveshare_ILI9486_Canvas8::flush(int16_t x, int16_t y)
+{
+	if (_pPlanes == nullptr) return 0;
+
+	uint32_t sent = 0;
+
+	Waveshare_ILI9486_Impl::startWrite();
+	for (int16_t i = 0; i < HEIGHT; i++)
+	{
+		const uint8_t start = _pDirtyStart[i];
+		const uint8_t end = _pDirtyEnd[i];
+		if (start >= end) continue;
+
+		const uint8_t *pRed = row(i);
+		const uint8_t *pGreen = pRed + _stride;
+		const uint8_t *pBlue = pGreen + _stride;
+		uint16_t *pOut = _pLine;
+
+		for (uint8_t b = start; b < end; b++)
+		{
+			const uint8_t red = pRed[b];
+			const uint8_t green = pGreen[b];
+			const uint8_t blue = pBlue[b];
+
+			for (uint8_t mask = 0x80; mask != 0; mask >>= 1)
+			{
+				*pOut++ = ((red & mask) ? 0xF800 : 0) | ((green & mask) ? 0x07E0 : 0) |
+					((blue & mask) ? 0x001F : 0);
+			}
+		}
+
+		//  The last byte can run past the edge of the buffer.
+		const int16_t left = start * 8;
+		const int16_t right = (end * 8 < WIDTH) ? end * 8 : WIDTH;
+		Waveshare_ILI9486_Impl::writeColors(x + left, y + i, right - left, 1, _pLine);
+		sent += right - left;
+
+		_pDirtyStart[i] = CLEAN_START;
+		_pDirtyEnd[i] = CLEAN_END;
+	}
+	Waveshare_ILI9486_Impl::endWrite();
+
+	return sent;
+}
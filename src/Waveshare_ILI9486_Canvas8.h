@@ -0,0 +1,110 @@
+//  Waveshare ILI9486 8 color canvas
+//  - 3 bit per pixel framebuffer for idle mode screens, flushed as RGB565.
+//
+//  In idle mode ('setIdleMode(true)') the panel only shows the top bit of red, green
+//  and blue - 8 colors.  Screens meant for that (standby, clocks, status) can be
+//  buffered at 3 bits a pixel: 57.6 KB for the whole panel, which fits on an ESP8266
+//  or an ESP32 without PSRAM.  Draw with the usual Adafruit_GFX calls, flicker free,
+//  then 'flush()' sends the parts of each row that changed, expanded back to RGB565.
+//
+//  The buffer is stored as three bit planes per row - red, green and blue - so a fill
+//  sets or clears whole bytes, 8 pixels at a time, and 1 bit bitmaps (icons, and
+//  'drawBitmap()' text) are written a byte at a time as well.  Colors are reduced the
+//  same way the panel does it in idle mode, by the top bit of each component, and come
+//  back out as black, blue, green, cyan, red, magenta, yellow or white.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_CANVAS8_h
+#define _WAVESHARE_ILI9486_CANVAS8_h
+
+class Waveshare_ILI9486_Canvas8 : public Adafruit_GFX
+{
+public:
+	//  Size of the buffered area, in pixels.  Defaults to the whole screen in
+	//  rotation(0) or rotation(2).
+	Waveshare_ILI9486_Canvas8(int16_t w = 320, int16_t h = 480);
+	~Waveshare_ILI9486_Canvas8();
+
+	//  Allocates the buffer, cleared to black.  Returns FALSE if there isn't enough
+	//  memory.
+	bool begin();
+
+	//  Adafruit GFX interface - these draw into the buffer only.
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	virtual void fillScreen(uint16_t color);
+
+	//  1 bit bitmaps, rows padded to a whole byte, from PROGMEM or RAM.  Without 'bg'
+	//  the clear bits are transparent.  Written a byte at a time in rotation 0, and a
+	//  pixel at a time otherwise.
+	using Adafruit_GFX::drawBitmap;
+	void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+		uint16_t color);
+	void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h,
+		uint16_t color, uint16_t bg);
+	void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+		uint16_t color);
+	void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+		uint16_t color, uint16_t bg);
+
+	//  The color as shown - one of the 8.
+	uint16_t getPixel(int16_t x, int16_t y) const;
+
+	//  Sends the rows, or parts of rows, drawn on since the last 'flush()', with the
+	//  top left corner of the buffer at (x, y) in the display's current rotation.  The
+	//  buffered area must fit on the screen.  Returns the number of pixels sent.
+	uint32_t flush(int16_t x = 0, int16_t y = 0);
+
+	//  The next 'flush()' sends the whole buffer.  Use this if something else has
+	//  drawn over the area.  'begin()' does this too, since the panel contents are
+	//  unknown.
+	void invalidate();
+
+	//  The 8 colors, index bits are red, green, blue from the top.
+	static uint16_t toColor(uint8_t index);
+	static uint8_t toIndex(uint16_t color);
+
+private:
+	//  Rotates a rectangle to buffer co-ordinates, after clipping.  Returns FALSE if
+	//  nothing is left.
+	bool toBuffer(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const;
+	//  Buffer co-ordinates, already clipped.
+	void fillBufferRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t index);
+	void markDirty(int16_t y, int16_t h, int16_t x, int16_t w);
+	void drawBits(int16_t x, int16_t y, const uint8_t *pBitmap, int16_t w, int16_t h,
+		uint16_t color, uint16_t bg, bool opaque, bool progmem);
+
+	uint8_t *row(int16_t y) const { return _pPlanes + (int32_t)y * 3 * _stride; }
+
+	uint8_t *_pPlanes;
+	uint16_t *_pLine;           //  One row of RGB565, for 'flush()'.
+	//  Bytes [start, end) of each row that have changed.  start >= end for none.
+	uint8_t *_pDirtyStart;
+	uint8_t *_pDirtyEnd;
+	int16_t _stride;            //  Bytes per plane per row.
+};
+
+#endif
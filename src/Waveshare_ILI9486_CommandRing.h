@@ -0,0 +1,107 @@
+//  Waveshare ILI9486 command ring
+//  - Lock-free single producer / single consumer ring buffer.
+//
+//  Used to hand draw commands from the application core to the render task on dual
+//  core ESP32 builds (see Waveshare_ILI9486_RenderTask.h).  It has no Arduino
+//  dependencies, so it can be built and exercised on a desktop with std::thread.
+//  Needs <atomic>, so it is not available on AVR.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_COMMANDRING_h
+#define _WAVESHARE_ILI9486_COMMANDRING_h
+
+#include <atomic>
+#include <stdint.h>
+
+//  Exactly one thread may call 'push()', and exactly one (other) thread may call
+//  'pop()'.  Items come out in the order they went in, and everything the producer
+//  wrote before a 'push()' is visible to the consumer once it has popped that item.
+//
+//  SIZE must be a power of two.  Head and tail are free running counters, so the ring
+//  can hold all SIZE items (no wasted slot).
+template<class T, uint16_t SIZE>
+class Waveshare_ILI9486_CommandRing
+{
+	static_assert((SIZE != 0) && ((SIZE & (SIZE - 1)) == 0), "SIZE must be a power of two");
+
+public:
+	Waveshare_ILI9486_CommandRing()
+		:_head(0), _tail(0)
+	{
+	}
+
+	//  Producer side.  Returns FALSE if the ring is full.
+	bool push(const T &item)
+	{
+		const uint32_t head = _head.load(std::memory_order_relaxed);
+		if (head - _tail.load(std::memory_order_acquire) >= SIZE)
+		{
+			return false;
+		}
+
+		_items[head & (SIZE - 1)] = item;
+
+		//  Publish the item.  Pairs with the acquire in 'pop()'.
+		_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	//  Consumer side.  Returns FALSE if the ring is empty.
+	bool pop(T &item)
+	{
+		const uint32_t tail = _tail.load(std::memory_order_relaxed);
+		if (tail == _head.load(std::memory_order_acquire))
+		{
+			return false;
+		}
+
+		item = _items[tail & (SIZE - 1)];
+
+		//  Hand the slot back.  Pairs with the acquire in 'push()'.
+		_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	//  Either side may call these, but the answer is only a snapshot.
+	bool empty() const
+	{
+		return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+	}
+
+	uint16_t size() const
+	{
+		return (uint16_t)(_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire));
+	}
+
+	static constexpr uint16_t capacity() { return SIZE; }
+
+private:
+	T _items[SIZE];
+
+	//  Written only by the producer / consumer respectively.
+	std::atomic<uint32_t> _head;
+	std::atomic<uint32_t> _tail;
+};
+
+#endif
@@ -0,0 +1,296 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+
+#include "Waveshare_ILI9486.h"
+#include "Waveshare_ILI9486_DoubleBuffer.h"
+
+
+namespace
+{
+	//  Lets the diff read two pixels at a time without upsetting the aliasing rules.
+	typedef uint32_t __attribute__((__may_alias__)) PixelPair;
+
+	uint16_t *allocateBuffer(size_t bytes)
+	{
+#if defined(ARDUINO_ARCH_ESP32) && defined(BOARD_HAS_PSRAM)
+		return (uint16_t *)ps_malloc(bytes);
+#else
+		return (uint16_t *)malloc(bytes);
+#endif
+	}
+
+	inline bool pairAligned(const uint16_t *pA, const uint16_t *pB)
+	{
+		return ((((uintptr_t)pA) | ((uintptr_t)pB)) & (sizeof(PixelPair) - 1)) == 0;
+	}
+
+	//  First pixel in [from, to) where the rows differ, or 'to' if there is none.
+	int16_t firstDifference(const uint16_t *pA, const uint16_t *pB, int16_t from, int16_t to)
+	{
+		//  Line up on a word, then compare two pixels at a time.
+		if ((from < to) && !pairAligned(pA + from, pB + from))
+		{
+			if (pA[from] != pB[from]) return from;
+			from++;
+		}
+
+		if (pairAligned(pA + from, pB + from))
+		{
+			const PixelPair *pWordA = (const PixelPair *)(pA + from);
+			const PixelPair *pWordB = (const PixelPair *)(pB + from);
+			while ((to - from >= 2) && (*pWordA == *pWordB))
+			{
+				pWordA++;
+				pWordB++;
+				from += 2;
+			}
+		}
+
+		while ((from < to) && (pA[from] == pB[from]))
+		{
+			from++;
+		}
+		return from;
+	}
+
+	//  First pixel in [from, to) where the rows match, or 'to' if there is none.
+	int16_t firstMatch(const uint16_t *pA, const uint16_t *pB, int16_t from, int16_t to)
+	{
+		if ((from < to) && !pairAligned(pA + from, pB + from))
+		{
+			if (pA[from] == pB[from]) return from;
+			from++;
+		}
+
+		if (pairAligned(pA + from, pB + from))
+		{
+			const PixelPair *pWordA = (const PixelPair *)(pA + from);
+			const PixelPair *pWordB = (const PixelPair *)(pB + from);
+			while (to - from >= 2)
+			{
+				//  Both halves must differ to skip the whole word.
+				uint32_t diff = *pWordA ^ *pWordB;
+				if (((diff & 0xFFFF) == 0) || ((diff >> 16) == 0))
+				{
+					break;
+				}
+				pWordA++;
+				pWordB++;
+				from += 2;
+			}
+		}
+
+		while ((from < to) && (pA[from] != pB[from]))
+		{
+			from++;
+		}
+		return from;
+	}
+}
+
+
+Waveshare_ILI9486_DoubleBuffer::Waveshare_ILI9486_DoubleBuffer(int16_t w, int16_t h)
+	:Adafruit_GFX(w, h), _pFront(nullptr), _pBack(nullptr), _fullRefresh(true)
+{
+}
+
+Waveshare_ILI9486_DoubleBuffer::~Waveshare_ILI9486_DoubleBuffer()
+{
+	free(_pFront);
+	free(_pBack);
+}
+
+bool
+Waveshare_ILI9486_DoubleBuffer::begin()
+{
+	if (_pBack != nullptr)
+	{
+		return true;
+	}
+
+	const size_t bytes = (size_t)WIDTH * (size_t)HEIGHT * sizeof(uint16_t);
+	_pFront = allocateBuffer(bytes);
+	_pBack = allocateBuffer(bytes);
+	if ((_pFront == nullptr) || (_pBack == nullptr))
+	{
+		free(_pFront);
+		free(_pBack);
+		_pFront = _pBack = nullptr;
+		return false;
+	}
+
+	memset(_pBack, 0, bytes);
+	_fullRefresh = true;
+	return true;
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+	fillBufferRect(x, y, 1, 1, color);
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+	fillBufferRect(x, y, 1, h, color);
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+	fillBufferRect(x, y, w, 1, color);
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	fillBufferRect(x, y, w, h, color);
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::fillScreen(uint16_t color)
+{
+	fillBufferRect(0, 0, _width, _height, color);
+}
+
+void
+Waveshare_ILI9486_DoubleBuffer::fillBufferRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	if (_pBack == nullptr) return;
+
+	if (w < 0)
+	{
+		w = -w;
+		x -= w;
+	}
+	if (h < 0)
+	{
+		h = -h;
+		y -= h;
+	}
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (x + w > _width) w = _width - x;
+	if (y + h > _height) h = _height - y;
+	if ((w <= 0) || (h <= 0)) return;
+
+	//  Same orientation handling as GFXcanvas16 - the buffer is always in rotation(0).
+	int16_t t;
+	switch (rotation)
+	{
+	case 1:
+		t = x;
+		x = WIDTH - y - h;
+		y = t;
+		t = w;
+		w = h;
+		h = t;
+		break;
+
+	case 2:
+		x = WIDTH - x - w;
+		y = HEIGHT - y - h;
+		break;
+
+	case 3:
+		t = y;
+		y = HEIGHT - x - w;
+		x = t;
+		t = w;
+		w = h;
+		h = t;
+		break;
+	}
+
+	uint16_t *pRow = _pBack + (int32_t)y * WIDTH + x;
+	while (h--)
+	{
+		for (int16_t i = 0; i < w; i++)
+		{
+			pRow[i] = color;
+		}
+		pRow += WIDTH;
+	}
+}
+
+uint32_t
+Waveshare_ILI9486_DoubleBuffer::present(int16_t x, int16_t y)
+{
+	if (_pBack == nullptr) return 0;
+
+	uint32_t sent = 0;
+
+	Waveshare_ILI9486_Impl::startWrite();
+	if (_fullRefresh)
+	{
+		Waveshare_ILI9486_Impl::writeColors(x, y, WIDTH, HEIGHT, _pBack);
+		memcpy(_pFront, _pBack, (size_t)WIDTH * (size_t)HEIGHT * sizeof(uint16_t));
+		sent = (uint32_t)WIDTH * (uint32_t)HEIGHT;
+		_fullRefresh = false;
+	}
+	else
+	{
+		for (int16_t row = 0; row < HEIGHT; row++)
+		{
+			uint16_t *pFront = _pFront + (int32_t)row * WIDTH;
+			uint16_t *pBack = _pBack + (int32_t)row * WIDTH;
+
+			int16_t col = firstDifference(pFront, pBack, 0, WIDTH);
+			while (col < WIDTH)
+			{
+				//  Grow the span while the next change is close enough that resending
+				//  the unchanged gap is cheaper than a new address window.
+				const int16_t start = col;
+				int16_t end;
+				for (;;)
+				{
+					end = firstMatch(pFront, pBack, col, WIDTH);
+					col = firstDifference(pFront, pBack, end, WIDTH);
+					if ((col >= WIDTH) || (col - end > SPAN_MERGE_GAP))
+					{
+						break;
+					}
+				}
+
+				Waveshare_ILI9486_Impl::writeColors(x + start, y + row, end - start, 1, pBack + start);
+				memcpy(pFront + start, pBack + start, (end - start) * sizeof(uint16_t));
+				sent += end - start;
+			}
+		}
+	}
+	Waveshare_ILI9486_Impl::endWrite();
+
+	return sent;
+}
@@ -0,0 +1,82 @@
+//  Waveshare ILI9486 double buffer
+//  - Front and back RGB565 framebuffers, with a scanline diff on 'present()'.
+//
+//  Draw the whole frame into the back buffer with the usual Adafruit_GFX calls, every
+//  frame if that's easiest, then call 'present()'.  Rows are compared against the front
+//  buffer (what the panel is showing) a 32 bit word at a time, and only the changed
+//  spans are sent.  Bus traffic ends up proportional to what actually changed on screen.
+//
+//  A full screen needs 2 x 300 KB, so this is meant for ESP32 boards with PSRAM (buffers
+//  come from 'ps_malloc()' when BOARD_HAS_PSRAM is set), or for smaller regions.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_DOUBLEBUFFER_h
+#define _WAVESHARE_ILI9486_DOUBLEBUFFER_h
+
+class Waveshare_ILI9486_DoubleBuffer : public Adafruit_GFX
+{
+public:
+	//  Size of the buffered area, in pixels.  Defaults to the whole screen in
+	//  rotation(0) or rotation(2).
+	Waveshare_ILI9486_DoubleBuffer(int16_t w = 320, int16_t h = 480);
+	~Waveshare_ILI9486_DoubleBuffer();
+
+	//  Allocates both buffers.  Returns FALSE if there isn't enough memory.
+	bool begin();
+
+	//  Adafruit GFX interface - these draw into the back buffer only.
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	virtual void fillScreen(uint16_t color);
+
+	uint16_t *getBuffer() const { return _pBack; }
+
+	//  Sends everything that changed since the last 'present()' to the panel, with the
+	//  top left corner of the buffer at (x, y) in the display's current rotation.  The
+	//  buffered area must fit on the screen.  Returns the number of pixels sent.
+	uint32_t present(int16_t x = 0, int16_t y = 0);
+
+	//  The next 'present()' sends the whole buffer.  Use this if something else has
+	//  drawn over the area.  'begin()' does this too, since the panel contents are
+	//  unknown.
+	void invalidate() { _fullRefresh = true; }
+
+	//  Changed spans closer together than this are sent as one.  Each span is a single
+	//  row, so the next span on the same row keeps half of the cached address window.
+	//  Only the other half and RAMWR are sent - 6 bus words, the same as 6 pixels.
+	//  test/bench_double_buffer.cpp sweeps the gap against a few kinds of change.
+	static constexpr int16_t SPAN_MERGE_GAP = 6;
+
+private:
+	//  Clipped, rotated to buffer co-ordinates, and filled.
+	void fillBufferRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+	uint16_t *_pFront;
+	uint16_t *_pBack;
+	bool _fullRefresh;
+};
+
+#endif
@@ -0,0 +1,779 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+//  Scanline rasterizers for the shapes Adafruit_GFX builds out of overlapping
+//  triangles and circles.  Everything comes out as horizontal spans, which are sent
+//  with 'writeFillRect2()'.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+
+#include "Waveshare_ILI9486.h"
+
+
+namespace
+{
+	//  Collects the spans for a shape, one row at a time, top to bottom.  A span that
+	//  exactly continues one from the row above grows that rectangle instead of being
+	//  sent, so straight sided parts of a shape go out as a single window.
+	class SpanSink
+	{
+	public:
+		SpanSink(uint16_t color)
+			:_color(color), _count(0)
+		{
+		}
+
+		~SpanSink()
+		{
+			flush();
+		}
+
+		//  Pixels [x0, x1) of row y.  Rows have to arrive in order.
+		void span(int16_t y, int16_t x0, int16_t x1)
+		{
+			if (x1 <= x0) return;
+
+			//  Anything not continued on the row before this one is finished.
+			for (uint8_t i = 0; i < _count;)
+			{
+				if (_pending[i].y + _pending[i].h < y)
+				{
+					send(i);
+				}
+				else
+				{
+					i++;
+				}
+			}
+
+			for (uint8_t i = 0; i < _count; i++)
+			{
+				Pending &p = _pending[i];
+				if ((p.x == x0) && (p.w == x1 - x0) && (p.y + p.h == y))
+				{
+					p.h++;
+					return;
+				}
+			}
+
+			if (_count == MAX_PENDING)
+			{
+				send(0);
+			}
+			Pending &p = _pending[_count++];
+			p.x = x0;
+			p.w = x1 - x0;
+			p.y = y;
+			p.h = 1;
+		}
+
+		void flush()
+		{
+			while (_count > 0)
+			{
+				send(0);
+			}
+		}
+
+	private:
+		struct Pending
+		{
+			int16_t x, w, y, h;
+		};
+
+		void send(uint8_t i)
+		{
+			const Pending &p = _pending[i];
+			Waveshare_ILI9486_Impl::writeFillRect2(p.x, p.y, p.w, p.h, _color);
+			_count--;
+			for (; i < _count; i++)
+			{
+				_pending[i] = _pending[i + 1];
+			}
+		}
+
+		static constexpr uint8_t MAX_PENDING = 8;
+
+		uint16_t _color;
+		uint8_t _count;
+		Pending _pending[MAX_PENDING];
+	};
+
+	//  Clips [x0, x1) to the clip rectangle and passes it on.
+	inline void clippedSpan(SpanSink &sink, int16_t y, int32_t x0, int32_t x1,
+		int16_t clipX, int16_t clipW)
+	{
+		if (x0 < clipX) x0 = clipX;
+		if (x1 > clipX + clipW) x1 = clipX + clipW;
+		sink.span(y, (int16_t)x0, (int16_t)x1);
+	}
+
+	//  Integer division, rounding towards minus / plus infinity.
+	inline int32_t floorDiv(int32_t n, int32_t d)
+	{
+		int32_t q = n / d;
+		if ((q * d != n) && ((n < 0) != (d < 0))) q--;
+		return q;
+	}
+
+	inline int32_t ceilDiv(int32_t n, int32_t d)
+	{
+		return -floorDiv(-n, d);
+	}
+
+	inline int64_t floorDiv64(int64_t n, int64_t d)
+	{
+		int64_t q = n / d;
+		if ((q * d != n) && ((n < 0) != (d < 0))) q--;
+		return q;
+	}
+
+	//  Under 2^14 either way - small enough to multiply two together, and add two of
+	//  those, in 32 bits.
+	inline bool fitsNear(int32_t n)
+	{
+		return (n > -0x4000) && (n < 0x4000);
+	}
+
+	//  Largest r with r * r <= n.
+	uint32_t isqrt(uint32_t n)
+	{
+		uint32_t root = 0;
+		uint32_t bit = 1UL << 30;
+		while (bit > n)
+		{
+			bit >>= 2;
+		}
+		while (bit != 0)
+		{
+			if (n >= root + bit)
+			{
+				n -= root + bit;
+				root = (root >> 1) + bit;
+			}
+			else
+			{
+				root >>= 1;
+			}
+			bit >>= 2;
+		}
+		return root;
+	}
+
+	//  Shapes are worked out in 1/16ths of a pixel, so thick lines and needles move
+	//  smoothly rather than jumping a whole pixel at a time.  Pixel (x, y) has its centre
+	//  at (16 x + 8, 16 y + 8).
+	constexpr int32_t SUBPIXEL = 16;
+
+	inline int32_t toSubpixel(int16_t pixel)
+	{
+		return (int32_t)pixel * SUBPIXEL + SUBPIXEL / 2;
+	}
+
+	//  sin() of 0 - 90 degrees, in Q14.
+	const int16_t sineTable[91] PROGMEM =
+	{
+		0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+		2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+		5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+		8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+		10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+		12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+		14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+		15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+		16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+		16384
+	};
+
+	int16_t sinQ14(int16_t degrees)
+	{
+		degrees %= 360;
+		if (degrees < 0) degrees += 360;
+
+		if (degrees <= 90) return pgm_read_word(sineTable + degrees);
+		if (degrees <= 180) return pgm_read_word(sineTable + 180 - degrees);
+		if (degrees <= 270) return -(int16_t)pgm_read_word(sineTable + degrees - 180);
+		return -(int16_t)pgm_read_word(sineTable + 360 - degrees);
+	}
+
+	inline int16_t cosQ14(int16_t degrees)
+	{
+		return sinQ14(degrees + 90);
+	}
+
+	//  One polygon edge, crossing rows [yTop, yBottom).  'col' is the first pixel on the
+	//  current row whose centre is on or right of the edge.  It's stepped exactly, like
+	//  a Bresenham line, so shared edges always agree on which pixels they cover.
+	//
+	//  On row y, with the centre at Y = 16 y + 8, the edge crosses at
+	//  x0 + (Y - y0) dx / dy.  'col' is ceil(N / D) with N = (x0 - 8) dy + (Y - y0) dx and
+	//  D = 16 dy, and 'remainder' is col * D - N.  Each row adds 16 dx to N, which is
+	//  'colStep' whole pixels plus 'remainderStep'.
+	struct Edge
+	{
+		int16_t col;
+		int16_t colStep;
+		int32_t remainder;
+		int32_t remainderStep;
+		int32_t denominator;
+		int32_t x0, y0, dx, dy;
+		int16_t yTop, yBottom;
+		int16_t row;                //  Row 'col' is for.
+		int8_t winding;
+
+		//  End points in subpixels.  Returns FALSE if the edge doesn't cross the middle
+		//  of any row.
+		bool set(int32_t xa, int32_t ya, int32_t xb, int32_t yb)
+		{
+			if (ya == yb) return false;
+
+			winding = (yb > ya) ? 1 : -1;
+			if (yb < ya)
+			{
+				int32_t t = xa; xa = xb; xb = t;
+				t = ya; ya = yb; yb = t;
+			}
+			x0 = xa;
+			y0 = ya;
+			dx = xb - xa;
+			dy = yb - ya;
+			denominator = SUBPIXEL * dy;
+			yTop = ceilDiv(ya - SUBPIXEL / 2, SUBPIXEL);
+			yBottom = ceilDiv(yb - SUBPIXEL / 2, SUBPIXEL);
+			row = INT16_MIN;
+			return yTop < yBottom;
+		}
+
+		void start(int16_t y)
+		{
+			const int32_t x = x0 - SUBPIXEL / 2;
+			const int32_t down = (int32_t)y * SUBPIXEL + SUBPIXEL / 2 - y0;
+			if (fitsNear(x) && fitsNear(dx) && fitsNear(dy) && fitsNear(down))
+			{
+				//  Within about 1000 pixels of the origin N is under 2^29, so 32 bits
+				//  are enough, with room for col * D.
+				const int32_t n = x * dy + down * dx;
+				const int32_t c = ceilDiv(n, denominator);
+				col = (int16_t)c;
+				remainder = c * denominator - n;
+			}
+			else
+			{
+				//  Further out N can need 40 bits.  Exact still, but on AVR a 64 bit
+				//  divide is a few thousand cycles and pulls in about 1 KB of flash.
+				const int64_t n = (int64_t)x * dy + (int64_t)down * dx;
+				const int64_t c = -floorDiv64(-n, denominator);
+				col = (int16_t)c;
+				remainder = (int32_t)(c * denominator - n);
+			}
+
+			colStep = floorDiv(dx, dy);
+			remainderStep = SUBPIXEL * (dx - colStep * dy);
+			row = y;
+		}
+
+		void step()
+		{
+			col += colStep;
+			remainder -= remainderStep;
+			if (remainder < 0)
+			{
+				col++;
+				remainder += denominator;
+			}
+			row++;
+		}
+
+		//  Brings 'col' to row y, which must be inside the edge.
+		void moveTo(int16_t y)
+		{
+			if (row == y - 1)
+			{
+				step();
+			}
+			else if (row != y)
+			{
+				start(y);
+			}
+		}
+	};
+
+	//  Thick line - a rectangle along the line, plus a disc on each end for round caps.
+	//  Convex, so each row is at most one span.
+	class ThickLine
+	{
+	public:
+		//  End points in subpixels.
+		ThickLine(int32_t xa, int32_t ya, int32_t xb, int32_t yb, uint8_t width, uint8_t cap)
+			:_round(cap == CAP_ROUND), _edgeCount(0)
+		{
+			int32_t dx = xb - xa;
+			int32_t dy = yb - ya;
+			int32_t length = isqrt((uint32_t)dx * (uint32_t)dx + (uint32_t)dy * (uint32_t)dy);
+			if (length == 0)
+			{
+				dx = length = 1;
+				dy = 0;
+			}
+
+			//  Half the width, across and along the line.
+			_radius = (int32_t)width * SUBPIXEL / 2;
+			const int32_t acrossX = -dy * _radius / length;
+			const int32_t acrossY = dx * _radius / length;
+			if (cap == CAP_SQUARE)
+			{
+				const int32_t alongX = dx * _radius / length;
+				const int32_t alongY = dy * _radius / length;
+				xa -= alongX;
+				ya -= alongY;
+				xb += alongX;
+				yb += alongY;
+			}
+
+			const int32_t x[4] = { xa + acrossX, xb + acrossX, xb - acrossX, xa - acrossX };
+			const int32_t y[4] = { ya + acrossY, yb + acrossY, yb - acrossY, ya - acrossY };
+			for (uint8_t i = 0; i < 4; i++)
+			{
+				if (_edges[_edgeCount].set(x[i], y[i], x[(i + 1) & 3], y[(i + 1) & 3]))
+				{
+					_edgeCount++;
+				}
+			}
+
+			_centreX[0] = xa;
+			_centreY[0] = ya;
+			_centreX[1] = xb;
+			_centreY[1] = yb;
+
+			//  Rows that might be touched - round caps stick out by the radius.
+			int32_t top = (ya < yb) ? ya : yb;
+			int32_t bottom = (ya < yb) ? yb : ya;
+			top -= _radius + SUBPIXEL;
+			bottom += _radius + SUBPIXEL;
+			_top = floorDiv(top, SUBPIXEL);
+			_bottom = ceilDiv(bottom, SUBPIXEL);
+		}
+
+		int16_t top() const { return _top; }
+		int16_t bottom() const { return _bottom; }
+
+		//  Pixels [x0, x1) on row y.  Returns FALSE if the row is empty.  Rows are
+		//  cheapest asked for in order.
+		bool row(int16_t y, int16_t &x0, int16_t &x1)
+		{
+			int16_t left = INT16_MAX, right = INT16_MIN;
+
+			for (uint8_t i = 0; i < _edgeCount; i++)
+			{
+				Edge &e = _edges[i];
+				if ((y < e.yTop) || (y >= e.yBottom)) continue;
+
+				e.moveTo(y);
+				if (e.col < left) left = e.col;
+				if (e.col > right) right = e.col;
+			}
+
+			if (_round)
+			{
+				const int32_t centreY = (int32_t)y * SUBPIXEL + SUBPIXEL / 2;
+				for (uint8_t i = 0; i < 2; i++)
+				{
+					const int32_t dy = centreY - _centreY[i];
+					if ((dy > _radius) || (dy < -_radius)) continue;
+
+					//  Pixel centres within the disc.
+					const int32_t half = isqrt((uint32_t)(_radius * _radius - dy * dy));
+					const int16_t first = ceilDiv(_centreX[i] - half - SUBPIXEL / 2, SUBPIXEL);
+					const int16_t last = floorDiv(_centreX[i] + half - SUBPIXEL / 2, SUBPIXEL) + 1;
+					if (first >= last) continue;
+					if (first < left) left = first;
+					if (last > right) right = last;
+				}
+			}
+
+			x0 = left;
+			x1 = right;
+			return left < right;
+		}
+
+	private:
+		Edge _edges[4];
+		bool _round;
+		uint8_t _edgeCount;
+		int32_t _radius;
+		int32_t _centreX[2], _centreY[2];
+		int16_t _top, _bottom;
+	};
+
+	//  Values of u where a * u <= b.
+	struct Range
+	{
+		int16_t lo, hi;             //  Inclusive, empty if lo > hi.
+	};
+
+	constexpr int16_t RANGE_MAX = 0x3FFF;
+
+	Range atMost(int32_t a, int32_t b)
+	{
+		Range r = { -RANGE_MAX, RANGE_MAX };
+		if (a == 0)
+		{
+			if (b < 0) r.lo = RANGE_MAX;
+		}
+		else if (a > 0)
+		{
+			const int32_t limit = floorDiv(b, a);
+			r.hi = (limit < RANGE_MAX) ? limit : RANGE_MAX;
+		}
+		else
+		{
+			const int32_t limit = ceilDiv(b, a);
+			r.lo = (limit > -RANGE_MAX) ? limit : -RANGE_MAX;
+		}
+		return r;
+	}
+
+	inline Range intersect(Range a, Range b)
+	{
+		Range r = { (a.lo > b.lo) ? a.lo : b.lo, (a.hi < b.hi) ? a.hi : b.hi };
+		return r;
+	}
+
+	//  Needle from the hub out to 'length' at 'angle'.
+	ThickLine needle(int16_t x, int16_t y, int16_t length, uint8_t width, int16_t angle)
+	{
+		const int32_t hubX = toSubpixel(x);
+		const int32_t hubY = toSubpixel(y);
+		const int32_t tipX = hubX + (((int32_t)length * SUBPIXEL * cosQ14(angle)) >> 14);
+		const int32_t tipY = hubY + (((int32_t)length * SUBPIXEL * sinQ14(angle)) >> 14);
+		return ThickLine(hubX, hubY, tipX, tipY, width, CAP_ROUND);
+	}
+}
+
+
+namespace Waveshare_ILI9486_Impl
+{
+	void fillPolygon(const WavesharePoint *pPoints, uint16_t count, uint8_t rule, uint16_t color,
+		int16_t originX, int16_t originY, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		if (count < 3) return;
+
+		//  Edge table, then the active edge list, as indexes into it.
+		Edge *pEdges = (Edge *)malloc(count * (sizeof(Edge) + sizeof(uint16_t)));
+		if (pEdges == nullptr) return;
+		uint16_t *pActive = (uint16_t *)(pEdges + count);
+
+		//  Build the edges, kept sorted by the first row they cross.  Horizontal edges
+		//  never cross the middle of a row, so they're dropped.
+		uint16_t edges = 0;
+		int16_t yMin = INT16_MAX, yMax = INT16_MIN;
+		for (uint16_t i = 0; i < count; i++)
+		{
+			//  Vertices are pixel corners, so (10, 10) to (60, 40) is 50 x 30 pixels.
+			const WavesharePoint &a = pPoints[i];
+			const WavesharePoint &b = pPoints[(i + 1 < count) ? i + 1 : 0];
+
+			Edge e;
+			if (!e.set(((int32_t)a.x + originX) * SUBPIXEL, ((int32_t)a.y + originY) * SUBPIXEL,
+				((int32_t)b.x + originX) * SUBPIXEL, ((int32_t)b.y + originY) * SUBPIXEL))
+			{
+				continue;
+			}
+
+			if (e.yTop < yMin) yMin = e.yTop;
+			if (e.yBottom > yMax) yMax = e.yBottom;
+
+			uint16_t j = edges++;
+			while ((j > 0) && (pEdges[j - 1].yTop > e.yTop))
+			{
+				pEdges[j] = pEdges[j - 1];
+				j--;
+			}
+			pEdges[j] = e;
+		}
+
+		if (yMin < clipY) yMin = clipY;
+		if (yMax > clipY + clipH) yMax = clipY + clipH;
+
+		SpanSink sink(color);
+		uint16_t next = 0;
+		uint16_t active = 0;
+		for (int16_t y = yMin; y < yMax; y++)
+		{
+			//  Drop edges that have ended, step the rest down a row.
+			uint16_t kept = 0;
+			for (uint16_t i = 0; i < active; i++)
+			{
+				Edge &e = pEdges[pActive[i]];
+				if (e.yBottom > y)
+				{
+					e.step();
+					pActive[kept++] = pActive[i];
+				}
+			}
+			active = kept;
+
+			//  Pick up edges starting here.  After clipping off the top, some start above.
+			while ((next < edges) && (pEdges[next].yTop <= y))
+			{
+				Edge &e = pEdges[next];
+				if (e.yBottom > y)
+				{
+					e.start(y);
+					pActive[active++] = next;
+				}
+				next++;
+			}
+
+			//  Keep the active list in column order.  It's nearly sorted from the last row,
+			//  so an insertion sort is cheap.  Edges landing on the same column can go in
+			//  either order, only the winding total to the left of a pixel matters.
+			for (uint16_t i = 1; i < active; i++)
+			{
+				const uint16_t index = pActive[i];
+				const int16_t col = pEdges[index].col;
+				uint16_t j = i;
+				while ((j > 0) && (pEdges[pActive[j - 1]].col > col))
+				{
+					pActive[j] = pActive[j - 1];
+					j--;
+				}
+				pActive[j] = index;
+			}
+
+			if (rule == FILL_EVEN_ODD)
+			{
+				for (uint16_t i = 0; i + 1 < active; i += 2)
+				{
+					clippedSpan(sink, y, pEdges[pActive[i]].col, pEdges[pActive[i + 1]].col,
+						clipX, clipW);
+				}
+			}
+			else
+			{
+				int16_t winding = 0;
+				int16_t start = 0;
+				for (uint16_t i = 0; i < active; i++)
+				{
+					const Edge &e = pEdges[pActive[i]];
+					if (winding == 0)
+					{
+						start = e.col;
+					}
+					winding += e.winding;
+					if (winding == 0)
+					{
+						clippedSpan(sink, y, start, e.col, clipX, clipW);
+					}
+				}
+			}
+		}
+		sink.flush();
+
+		free(pEdges);
+	}
+
+	void fillThickLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t width, uint8_t cap,
+		uint16_t color, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		if (width == 0) return;
+
+		ThickLine line(toSubpixel(x0), toSubpixel(y0), toSubpixel(x1), toSubpixel(y1), width, cap);
+		const int16_t top = (line.top() > clipY) ? line.top() : clipY;
+		const int16_t bottom = (line.bottom() < clipY + clipH) ? line.bottom() : clipY + clipH;
+
+		SpanSink sink(color);
+		for (int16_t y = top; y < bottom; y++)
+		{
+			int16_t left, right;
+			if (line.row(y, left, right))
+			{
+				clippedSpan(sink, y, left, right, clipX, clipW);
+			}
+		}
+	}
+
+	void fillArc(int16_t x, int16_t y, int16_t innerRadius, int16_t outerRadius,
+		int16_t startAngle, int16_t endAngle, uint16_t color,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		if ((outerRadius < 0) || (innerRadius > outerRadius)) return;
+
+		//  Clockwise sweep from the start angle, in 0 - 360.
+		int16_t sweep = endAngle - startAngle;
+		const bool full = (sweep >= 360) || (sweep <= -360);
+		sweep %= 360;
+		if (sweep < 0) sweep += 360;
+		if ((sweep == 0) && !full) return;
+
+		//  The sector is the pixels clockwise of the start ray and anticlockwise of the
+		//  end ray - both, if it's 180 degrees or less, otherwise either.
+		const int32_t startCos = cosQ14(startAngle), startSin = sinQ14(startAngle);
+		const int32_t endCos = cosQ14(endAngle), endSin = sinQ14(endAngle);
+
+		//  Pixel centres at distance d from the centre are in the band if
+		//  inner - 1/2 <= d < outer + 1/2, so the band is outer - inner + 1 pixels wide.
+		const int32_t outer2 = (2L * outerRadius + 1) * (2L * outerRadius + 1);
+		const int32_t inner2 = (innerRadius > 0) ? (2L * innerRadius - 1) * (2L * innerRadius - 1) : 0;
+
+		int16_t top = y - outerRadius, bottom = y + outerRadius + 1;
+		if (top < clipY) top = clipY;
+		if (bottom > clipY + clipH) bottom = clipY + clipH;
+
+		SpanSink sink(color);
+		for (int16_t row = top; row < bottom; row++)
+		{
+			const int32_t v = row - y;
+
+			//  Band - largest |u| with 4 (u^2 + v^2) < outer2, and the hole inside.
+			const int32_t outerLeft = outer2 - 4 * v * v;
+			if (outerLeft <= 0) continue;
+			const int16_t uOuter = isqrt((outerLeft - 1) >> 2);
+
+			Range band[2];
+			uint8_t bands = 0;
+			const int32_t innerLeft = inner2 - 4 * v * v;
+			if (innerLeft > 0)
+			{
+				const int16_t uInner = isqrt((innerLeft - 1) >> 2);
+				band[bands++] = { (int16_t)-uOuter, (int16_t)(-uInner - 1) };
+				band[bands++] = { (int16_t)(uInner + 1), uOuter };
+			}
+			else
+			{
+				band[bands++] = { (int16_t)-uOuter, uOuter };
+			}
+
+			//  Sector, as up to two ranges in order.
+			Range sector[2];
+			uint8_t sectors = 0;
+			if (full)
+			{
+				sector[sectors++] = { -RANGE_MAX, RANGE_MAX };
+			}
+			else
+			{
+				//  cross(start, p) >= 0, and cross(p, end) >= 0.
+				const Range afterStart = atMost(startSin, startCos * v);
+				const Range beforeEnd = atMost(-endSin, -endCos * v);
+				if (sweep <= 180)
+				{
+					sector[sectors++] = intersect(afterStart, beforeEnd);
+				}
+				else
+				{
+					const bool startFirst = afterStart.lo <= beforeEnd.lo;
+					const Range &a = startFirst ? afterStart : beforeEnd;
+					const Range &b = startFirst ? beforeEnd : afterStart;
+					if (a.lo > a.hi)
+					{
+						sector[sectors++] = b;
+					}
+					else if (b.lo > b.hi)
+					{
+						sector[sectors++] = a;
+					}
+					else if (b.lo <= a.hi + 1)
+					{
+						sector[sectors++] = { a.lo, (a.hi > b.hi) ? a.hi : b.hi };
+					}
+					else
+					{
+						sector[sectors++] = a;
+						sector[sectors++] = b;
+					}
+				}
+			}
+
+			for (uint8_t i = 0; i < bands; i++)
+			{
+				for (uint8_t j = 0; j < sectors; j++)
+				{
+					const Range r = intersect(band[i], sector[j]);
+					if (r.lo <= r.hi)
+					{
+						clippedSpan(sink, row, x + r.lo, x + r.hi + 1, clipX, clipW);
+					}
+				}
+			}
+		}
+	}
+
+	void fillNeedle(int16_t x, int16_t y, int16_t length, uint8_t width, int16_t angle,
+		uint16_t color, int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		//  Same shape as a thick line, but from the subpixel tip.
+		ThickLine line = needle(x, y, length, width, angle);
+		const int16_t top = (line.top() > clipY) ? line.top() : clipY;
+		const int16_t bottom = (line.bottom() < clipY + clipH) ? line.bottom() : clipY + clipH;
+
+		SpanSink sink(color);
+		for (int16_t row = top; row < bottom; row++)
+		{
+			int16_t left, right;
+			if (line.row(row, left, right))
+			{
+				clippedSpan(sink, row, left, right, clipX, clipW);
+			}
+		}
+	}
+
+	void moveNeedle(int16_t x, int16_t y, int16_t length, uint8_t width,
+		int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bg,
+		int16_t clipX, int16_t clipY, int16_t clipW, int16_t clipH)
+	{
+		ThickLine before = needle(x, y, length, width, oldAngle);
+		ThickLine after = needle(x, y, length, width, newAngle);
+
+		int16_t top = (before.top() < after.top()) ? before.top() : after.top();
+		int16_t bottom = (before.bottom() > after.bottom()) ? before.bottom() : after.bottom();
+		if (top < clipY) top = clipY;
+		if (bottom > clipY + clipH) bottom = clipY + clipH;
+
+		SpanSink erase(bg);
+		SpanSink draw(color);
+		for (int16_t row = top; row < bottom; row++)
+		{
+			int16_t oldLeft, oldRight, newLeft, newRight;
+			const bool hadOld = before.row(row, oldLeft, oldRight);
+			const bool hasNew = after.row(row, newLeft, newRight);
+
+			//  Where there's nothing on one side, use an empty span that can't overlap.
+			if (!hadOld)
+			{
+				oldLeft = oldRight = newRight;
+			}
+			if (!hasNew)
+			{
+				newLeft = newRight = oldRight;
+			}
+
+			//  Old minus new is erased, new minus old is drawn.  The overlap is left alone.
+			clippedSpan(erase, row, oldLeft, (oldRight < newLeft) ? oldRight : newLeft, clipX, clipW);
+			clippedSpan(erase, row, (oldLeft > newRight) ? oldLeft : newRight, oldRight, clipX, clipW);
+			clippedSpan(draw, row, newLeft, (newRight < oldLeft) ? newRight : oldLeft, clipX, clipW);
+			clippedSpan(draw, row, (newLeft > oldRight) ? newLeft : oldRight, newRight, clipX, clipW);
+		}
+	}
+}
@@ -0,0 +1,1106 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+//  Baseline JPEG decoding, an MCU at a time.  The IDCT and color conversion are
+//  libjpeg's integer ones, so the output matches it exactly (with 'dct_method' of
+//  JDCT_ISLOW and no fancy upsampling).
+
+#include <Arduino.h>
+
+#include "Waveshare_ILI9486_Jpeg.h"
+
+
+namespace
+{
+	//  Markers.
+	constexpr uint8_t SOF0 = 0xC0;
+	constexpr uint8_t SOF1 = 0xC1;
+	constexpr uint8_t DHT = 0xC4;
+	constexpr uint8_t RST0 = 0xD0;
+	constexpr uint8_t RST7 = 0xD7;
+	constexpr uint8_t SOI = 0xD8;
+	constexpr uint8_t EOI = 0xD9;
+	constexpr uint8_t SOS = 0xDA;
+	constexpr uint8_t DQT = 0xDB;
+	constexpr uint8_t DRI = 0xDD;
+
+	//  Position of each zigzag coefficient in the block.
+	const uint8_t zigzag[64] PROGMEM =
+	{
+		 0,  1,  8, 16,  9,  2,  3, 10,
+		17, 24, 32, 25, 18, 11,  4,  5,
+		12, 19, 26, 33, 40, 48, 41, 34,
+		27, 20, 13,  6,  7, 14, 21, 28,
+		35, 42, 49, 56, 57, 50, 43, 36,
+		29, 22, 15, 23, 30, 37, 44, 51,
+		58, 59, 52, 45, 38, 31, 39, 46,
+		53, 60, 61, 54, 47, 55, 62, 63
+	};
+
+	//  IDCT constants, scaled by 2^13.
+	constexpr uint8_t CONST_BITS = 13;
+	constexpr uint8_t PASS1_BITS = 2;
+	constexpr int32_t FIX_0_211164243 = 1730;
+	constexpr int32_t FIX_0_298631336 = 2446;
+	constexpr int32_t FIX_0_390180644 = 3196;
+	constexpr int32_t FIX_0_509795579 = 4176;
+	constexpr int32_t FIX_0_541196100 = 4433;
+	constexpr int32_t FIX_0_601344887 = 4926;
+	constexpr int32_t FIX_0_720959822 = 5906;
+	constexpr int32_t FIX_0_765366865 = 6270;
+	constexpr int32_t FIX_0_850430095 = 6967;
+	constexpr int32_t FIX_0_899976223 = 7373;
+	constexpr int32_t FIX_1_061594337 = 8697;
+	constexpr int32_t FIX_1_175875602 = 9633;
+	constexpr int32_t FIX_1_272758580 = 10426;
+	constexpr int32_t FIX_1_451774981 = 11893;
+	constexpr int32_t FIX_1_501321110 = 12299;
+	constexpr int32_t FIX_1_847759065 = 15137;
+	constexpr int32_t FIX_1_961570560 = 16069;
+	constexpr int32_t FIX_2_053119869 = 16819;
+	constexpr int32_t FIX_2_172734803 = 17799;
+	constexpr int32_t FIX_2_562915447 = 20995;
+	constexpr int32_t FIX_3_072711026 = 25172;
+	constexpr int32_t FIX_3_624509785 = 29692;
+
+	//  Color conversion constants, scaled by 2^16.
+	constexpr int32_t FIX_1_40200 = 91881;
+	constexpr int32_t FIX_1_77200 = 116130;
+	constexpr int32_t FIX_0_71414 = 46802;
+	constexpr int32_t FIX_0_34414 = 22554;
+	constexpr int32_t ONE_HALF = 32768;
+
+	//  Rounding right shift.  Negative values are shifted arithmetically, as libjpeg
+	//  does.
+	inline int32_t descale(int32_t x, uint8_t n)
+	{
+		return (x + (int32_t(1) << (n - 1))) >> n;
+	}
+
+	//  Dequantized coefficients, and the column results in the IDCTs, are range limited
+	//  to 15 bits.  That keeps every sum and product in the IDCTs inside 32 bits,
+	//  whatever the data - the largest is about 85759 * 16383, in the 2x2 one.  A real
+	//  8 bit image comes nowhere near; its coefficients are at most about 1150, and the
+	//  column results a few thousand, so the limit never changes its output.
+	constexpr int16_t COEFFICIENT_LIMIT = 16383;
+
+	inline int16_t clampCoefficient(int32_t x)
+	{
+		return (x < -COEFFICIENT_LIMIT) ? -COEFFICIENT_LIMIT : ((x > COEFFICIENT_LIMIT) ? COEFFICIENT_LIMIT : x);
+	}
+
+	inline uint8_t clampSample(int32_t x)
+	{
+		return (x < 0) ? 0 : ((x > 255) ? 255 : x);
+	}
+
+	inline uint16_t color565(uint8_t r, uint8_t g, uint8_t b)
+	{
+		return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+	}
+
+	uint16_t yccTo565(uint8_t y, uint8_t cb, uint8_t cr)
+	{
+		const int32_t blue = int32_t(cb) - 128;
+		const int32_t red = int32_t(cr) - 128;
+
+		return color565(
+			clampSample(y + ((FIX_1_40200 * red + ONE_HALF) >> 16)),
+			clampSample(y + ((-FIX_0_34414 * blue - FIX_0_71414 * red + ONE_HALF) >> 16)),
+			clampSample(y + ((FIX_1_77200 * blue + ONE_HALF) >> 16)));
+	}
+
+	//  A magnitude category and its extra bits, back to the signed value.
+	inline int16_t extend(uint16_t bits, uint8_t size)
+	{
+		return (bits < (1u << (size - 1))) ? int16_t(bits) - int16_t((1u << size) - 1) : int16_t(bits);
+	}
+
+	//  libjpeg's 'jpeg_idct_islow()', on a dequantized block in natural order, to 8x8
+	//  samples with rows 'stride' apart.  Shifts of values that can be negative are
+	//  written as multiplies.
+	void inverseDct(const int16_t *pIn, uint8_t *pOut, uint8_t stride)
+	{
+		int16_t workspace[64];
+
+		//  Columns, leaving the results scaled up by 2^PASS1_BITS.
+		for (uint8_t column = 0; column < 8; column++)
+		{
+			const int16_t *pColumn = pIn + column;
+			int16_t *pWork = workspace + column;
+
+			if (pColumn[8] == 0 && pColumn[16] == 0 && pColumn[24] == 0 && pColumn[32] == 0 &&
+				pColumn[40] == 0 && pColumn[48] == 0 && pColumn[56] == 0)
+			{
+				const int16_t dc = clampCoefficient(int32_t(pColumn[0]) * (1 << PASS1_BITS));
+
+				for (uint8_t i = 0; i < 64; i += 8)
+				{
+					pWork[i] = dc;
+				}
+				continue;
+			}
+
+			int32_t z2 = pColumn[16];
+			int32_t z3 = pColumn[48];
+			int32_t z1 = (z2 + z3) * FIX_0_541196100;
+			int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+			int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+
+			z2 = pColumn[0];
+			z3 = pColumn[32];
+			int32_t tmp0 = (z2 + z3) * (1 << CONST_BITS);
+			int32_t tmp1 = (z2 - z3) * (1 << CONST_BITS);
+
+			const int32_t tmp10 = tmp0 + tmp3;
+			const int32_t tmp13 = tmp0 - tmp3;
+			const int32_t tmp11 = tmp1 + tmp2;
+			const int32_t tmp12 = tmp1 - tmp2;
+
+			tmp0 = pColumn[56];
+			tmp1 = pColumn[40];
+			tmp2 = pColumn[24];
+			tmp3 = pColumn[8];
+
+			z1 = tmp0 + tmp3;
+			z2 = tmp1 + tmp2;
+			z3 = tmp0 + tmp2;
+			int32_t z4 = tmp1 + tmp3;
+			const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+			tmp0 *= FIX_0_298631336;
+			tmp1 *= FIX_2_053119869;
+			tmp2 *= FIX_3_072711026;
+			tmp3 *= FIX_1_501321110;
+			z1 *= -FIX_0_899976223;
+			z2 *= -FIX_2_562915447;
+			z3 = z3 * -FIX_1_961570560 + z5;
+			z4 = z4 * -FIX_0_390180644 + z5;
+
+			tmp0 += z1 + z3;
+			tmp1 += z2 + z4;
+			tmp2 += z2 + z3;
+			tmp3 += z1 + z4;
+
+			constexpr uint8_t SHIFT = CONST_BITS - PASS1_BITS;
+			pWork[0] = clampCoefficient(descale(tmp10 + tmp3, SHIFT));
+			pWork[56] = clampCoefficient(descale(tmp10 - tmp3, SHIFT));
+			pWork[8] = clampCoefficient(descale(tmp11 + tmp2, SHIFT));
+			pWork[48] = clampCoefficient(descale(tmp11 - tmp2, SHIFT));
+			pWork[16] = clampCoefficient(descale(tmp12 + tmp1, SHIFT));
+			pWork[40] = clampCoefficient(descale(tmp12 - tmp1, SHIFT));
+			pWork[24] = clampCoefficient(descale(tmp13 + tmp0, SHIFT));
+			pWork[32] = clampCoefficient(descale(tmp13 - tmp0, SHIFT));
+		}
+
+		//  Rows, removing the scaling and the factor of 8 in the transform.
+		for (uint8_t row = 0; row < 8; row++)
+		{
+			const int16_t *pWork = workspace + row * 8;
+			uint8_t *pRow = pOut + row * stride;
+
+			if (pWork[1] == 0 && pWork[2] == 0 && pWork[3] == 0 && pWork[4] == 0 &&
+				pWork[5] == 0 && pWork[6] == 0 && pWork[7] == 0)
+			{
+				const uint8_t sample = clampSample(descale(pWork[0], PASS1_BITS + 3) + 128);
+
+				memset(pRow, sample, 8);
+				continue;
+			}
+
+			int32_t z2 = pWork[2];
+			int32_t z3 = pWork[6];
+			int32_t z1 = (z2 + z3) * FIX_0_541196100;
+			int32_t tmp2 = z1 - z3 * FIX_1_847759065;
+			int32_t tmp3 = z1 + z2 * FIX_0_765366865;
+
+			z2 = pWork[0];
+			z3 = pWork[4];
+			int32_t tmp0 = (z2 + z3) * (1 << CONST_BITS);
+			int32_t tmp1 = (z2 - z3) * (1 << CONST_BITS);
+
+			const int32_t tmp10 = tmp0 + tmp3;
+			const int32_t tmp13 = tmp0 - tmp3;
+			const int32_t tmp11 = tmp1 + tmp2;
+			const int32_t tmp12 = tmp1 - tmp2;
+
+			tmp0 = pWork[7];
+			tmp1 = pWork[5];
+			tmp2 = pWork[3];
+			tmp3 = pWork[1];
+
+			z1 = tmp0 + tmp3;
+			z2 = tmp1 + tmp2;
+			z3 = tmp0 + tmp2;
+			int32_t z4 = tmp1 + tmp3;
+			const int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+			tmp0 *= FIX_0_298631336;
+			tmp1 *= FIX_2_053119869;
+			tmp2 *= FIX_3_072711026;
+			tmp3 *= FIX_1_501321110;
+			z1 *= -FIX_0_899976223;
+			z2 *= -FIX_2_562915447;
+			z3 = z3 * -FIX_1_961570560 + z5;
+			z4 = z4 * -FIX_0_390180644 + z5;
+
+			tmp0 += z1 + z3;
+			tmp1 += z2 + z4;
+			tmp2 += z2 + z3;
+			tmp3 += z1 + z4;
+
+			constexpr uint8_t SHIFT = CONST_BITS + PASS1_BITS + 3;
+			pRow[0] = clampSample(descale(tmp10 + tmp3, SHIFT) + 128);
+			pRow[7] = clampSample(descale(tmp10 - tmp3, SHIFT) + 128);
+			pRow[1] = clampSample(descale(tmp11 + tmp2, SHIFT) + 128);
+			pRow[6] = clampSample(descale(tmp11 - tmp2, SHIFT) + 128);
+			pRow[2] = clampSample(descale(tmp12 + tmp1, SHIFT) + 128);
+			pRow[5] = clampSample(descale(tmp12 - tmp1, SHIFT) + 128);
+			pRow[3] = clampSample(descale(tmp13 + tmp0, SHIFT) + 128);
+			pRow[4] = clampSample(descale(tmp13 - tmp0, SHIFT) + 128);
+		}
+	}
+
+	//  libjpeg's 'jpeg_idct_4x4()', for 1/2 scale - 4x4 samples straight from the low
+	//  frequencies of the block.  Row and column 4 of the block aren't used.
+	void inverseDct4(const int16_t *pIn, uint8_t *pOut, uint8_t stride)
+	{
+		int16_t workspace[8 * 4];
+
+		//  Columns, leaving the results scaled up by 2^PASS1_BITS.
+		for (uint8_t column = 0; column < 8; column++)
+		{
+			if (column == 4)
+			{
+				continue;
+			}
+
+			const int16_t *pColumn = pIn + column;
+			int16_t *pWork = workspace + column;
+
+			if (pColumn[8] == 0 && pColumn[16] == 0 && pColumn[24] == 0 &&
+				pColumn[40] == 0 && pColumn[48] == 0 && pColumn[56] == 0)
+			{
+				const int16_t dc = clampCoefficient(int32_t(pColumn[0]) * (1 << PASS1_BITS));
+
+				for (uint8_t i = 0; i < 32; i += 8)
+				{
+					pWork[i] = dc;
+				}
+				continue;
+			}
+
+			int32_t tmp0 = int32_t(pColumn[0]) * (1 << (CONST_BITS + 1));
+			int32_t tmp2 = int32_t(pColumn[16]) * FIX_1_847759065 - int32_t(pColumn[48]) * FIX_0_765366865;
+
+			const int32_t tmp10 = tmp0 + tmp2;
+			const int32_t tmp12 = tmp0 - tmp2;
+
+			const int32_t z1 = pColumn[56];
+			const int32_t z2 = pColumn[40];
+			const int32_t z3 = pColumn[24];
+			const int32_t z4 = pColumn[8];
+
+			tmp0 = z1 * -FIX_0_211164243 + z2 * FIX_1_451774981 + z3 * -FIX_2_172734803 + z4 * FIX_1_061594337;
+			tmp2 = z1 * -FIX_0_509795579 + z2 * -FIX_0_601344887 + z3 * FIX_0_899976223 + z4 * FIX_2_562915447;
+
+			constexpr uint8_t SHIFT = CONST_BITS - PASS1_BITS + 1;
+			pWork[0] = clampCoefficient(descale(tmp10 + tmp2, SHIFT));
+			pWork[24] = clampCoefficient(descale(tmp10 - tmp2, SHIFT));
+			pWork[8] = clampCoefficient(descale(tmp12 + tmp0, SHIFT));
+			pWork[16] = clampCoefficient(descale(tmp12 - tmp0, SHIFT));
+		}
+
+		//  Rows.
+		for (uint8_t row = 0; row < 4; row++)
+		{
+			const int16_t *pWork = workspace + row * 8;
+			uint8_t *pRow = pOut + row * stride;
+
+			if (pWork[1] == 0 && pWork[2] == 0 && pWork[3] == 0 &&
+				pWork[5] == 0 && pWork[6] == 0 && pWork[7] == 0)
+			{
+				const uint8_t sample = clampSample(descale(pWork[0], PASS1_BITS + 3) + 128);
+
+				memset(pRow, sample, 4);
+				continue;
+			}
+
+			int32_t tmp0 = int32_t(pWork[0]) * (1 << (CONST_BITS + 1));
+			int32_t tmp2 = int32_t(pWork[2]) * FIX_1_847759065 - int32_t(pWork[6]) * FIX_0_765366865;
+
+			const int32_t tmp10 = tmp0 + tmp2;
+			const int32_t tmp12 = tmp0 - tmp2;
+
+			const int32_t z1 = pWork[7];
+			const int32_t z2 = pWork[5];
+			const int32_t z3 = pWork[3];
+			const int32_t z4 = pWork[1];
+
+			tmp0 = z1 * -FIX_0_211164243 + z2 * FIX_1_451774981 + z3 * -FIX_2_172734803 + z4 * FIX_1_061594337;
+			tmp2 = z1 * -FIX_0_509795579 + z2 * -FIX_0_601344887 + z3 * FIX_0_899976223 + z4 * FIX_2_562915447;
+
+			constexpr uint8_t SHIFT = CONST_BITS + PASS1_BITS + 3 + 1;
+			pRow[0] = clampSample(descale(tmp10 + tmp2, SHIFT) + 128);
+			pRow[3] = clampSample(descale(tmp10 - tmp2, SHIFT) + 128);
+			pRow[1] = clampSample(descale(tmp12 + tmp0, SHIFT) + 128);
+			pRow[2] = clampSample(descale(tmp12 - tmp0, SHIFT) + 128);
+		}
+	}
+
+	//  libjpeg's 'jpeg_idct_2x2()', for 1/4 scale.  Only the DC and odd frequencies
+	//  are used.
+	void inverseDct2(const int16_t *pIn, uint8_t *pOut, uint8_t stride)
+	{
+		int16_t workspace[8 * 2];
+
+		//  Columns, leaving the results scaled up by 2^PASS1_BITS.
+		for (uint8_t column = 0; column < 8; column++)
+		{
+			if (column == 2 || column == 4 || column == 6)
+			{
+				continue;
+			}
+
+			const int16_t *pColumn = pIn + column;
+			int16_t *pWork = workspace + column;
+
+			if (pColumn[8] == 0 && pColumn[24] == 0 && pColumn[40] == 0 && pColumn[56] == 0)
+			{
+				const int16_t dc = clampCoefficient(int32_t(pColumn[0]) * (1 << PASS1_BITS));
+
+				pWork[0] = dc;
+				pWork[8] = dc;
+				continue;
+			}
+
+			const int32_t tmp10 = int32_t(pColumn[0]) * (int32_t(1) << (CONST_BITS + 2));
+			const int32_t tmp0 = int32_t(pColumn[56]) * -FIX_0_720959822 + int32_t(pColumn[40]) * FIX_0_850430095 +
+				int32_t(pColumn[24]) * -FIX_1_272758580 + int32_t(pColumn[8]) * FIX_3_624509785;
+
+			constexpr uint8_t SHIFT = CONST_BITS - PASS1_BITS + 2;
+			pWork[0] = clampCoefficient(descale(tmp10 + tmp0, SHIFT));
+			pWork[8] = clampCoefficient(descale(tmp10 - tmp0, SHIFT));
+		}
+
+		//  Rows.
+		for (uint8_t row = 0; row < 2; row++)
+		{
+			const int16_t *pWork = workspace + row * 8;
+			uint8_t *pRow = pOut + row * stride;
+
+			if (pWork[1] == 0 && pWork[3] == 0 && pWork[5] == 0 && pWork[7] == 0)
+			{
+				const uint8_t sample = clampSample(descale(pWork[0], PASS1_BITS + 3) + 128);
+
+				pRow[0] = sample;
+				pRow[1] = sample;
+				continue;
+			}
+
+			const int32_t tmp10 = int32_t(pWork[0]) * (int32_t(1) << (CONST_BITS + 2));
+			const int32_t tmp0 = int32_t(pWork[7]) * -FIX_0_720959822 + int32_t(pWork[5]) * FIX_0_850430095 +
+				int32_t(pWork[3]) * -FIX_1_272758580 + int32_t(pWork[1]) * FIX_3_624509785;
+
+			constexpr uint8_t SHIFT = CONST_BITS + PASS1_BITS + 3 + 2;
+			pRow[0] = clampSample(descale(tmp10 + tmp0, SHIFT) + 128);
+			pRow[1] = clampSample(descale(tmp10 - tmp0, SHIFT) + 128);
+		}
+	}
+}
+
+
+Waveshare_ILI9486_Jpeg::Waveshare_ILI9486_Jpeg()
+	:_read(nullptr), _pContext(nullptr), _pMemory(nullptr), _memoryLeft(0),
+	_inputPos(0), _inputLength(0), _headerRead(false), _width(0), _height(0)
+{
+}
+
+void
+Waveshare_ILI9486_Jpeg::begin(
+	ReadFunction read,
+	void *pContext)
+{
+	_read = read;
+	_pContext = pContext;
+	_inputPos = _inputLength = 0;
+	_headerRead = false;
+	_width = _height = 0;
+}
+
+void
+Waveshare_ILI9486_Jpeg::begin(
+	const uint8_t *pData,
+	size_t size)
+{
+	_pMemory = pData;
+	_memoryLeft = size;
+	begin(&readMemory, this);
+}
+
+size_t
+Waveshare_ILI9486_Jpeg::readMemory(
+	void *pContext,
+	uint8_t *pBuffer,
+	size_t count)
+{
+	Waveshare_ILI9486_Jpeg *pJpeg = static_cast<Waveshare_ILI9486_Jpeg *>(pContext);
+
+	if (count > pJpeg->_memoryLeft) count = pJpeg->_memoryLeft;
+	memcpy(pBuffer, pJpeg->_pMemory, count);
+	pJpeg->_pMemory += count;
+	pJpeg->_memoryLeft -= count;
+
+	return count;
+}
+
+size_t
+Waveshare_ILI9486_Jpeg::yieldingRead(
+	void *pContext,
+	uint8_t *pBuffer,
+	size_t count)
+{
+	const YieldingSource *pSource = static_cast<const YieldingSource *>(pContext);
+
+	//  The LCD still has chip select, inside the bus hold.  The next block drawn
+	//  reopens it.
+	pSource->yield(pSource->pDisplay);
+	return pSource->read(pSource->pContext, pBuffer, count);
+}
+
+//  Next byte of the file, or -1 at the end.
+int
+Waveshare_ILI9486_Jpeg::readByte()
+{
+	if (_inputPos == _inputLength)
+	{
+		_inputPos = 0;
+		_inputLength = (_read != nullptr) ? _read(_pContext, _input, INPUT_SIZE) : 0;
+		if (_inputLength == 0) return -1;
+	}
+
+	return _input[_inputPos++];
+}
+
+int
+Waveshare_ILI9486_Jpeg::readWord()
+{
+	const int high = readByte();
+	const int low = readByte();
+
+	return (high < 0 || low < 0) ? -1 : ((high << 8) | low);
+}
+
+bool
+Waveshare_ILI9486_Jpeg::skip(
+	uint16_t count)
+{
+	while (count-- > 0)
+	{
+		if (readByte() < 0) return false;
+	}
+
+	return true;
+}
+
+//  Skips to the next marker, and returns its code.  -1 at the end of the file.
+int
+Waveshare_ILI9486_Jpeg::nextMarker()
+{
+	for (;;)
+	{
+		int c;
+
+		do
+		{
+			c = readByte();
+			if (c < 0) return -1;
+		} while (c != 0xFF);
+
+		do
+		{
+			c = readByte();
+		} while (c == 0xFF);
+
+		//  0xFF00 is a stuffed byte, not a marker.
+		if (c != 0) return c;
+	}
+}
+
+bool
+Waveshare_ILI9486_Jpeg::readHeader()
+{
+	_headerRead = false;
+	_componentCount = 0;
+	_restartInterval = 0;
+	_quantDefined = 0;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		_huffman[i].defined = false;
+	}
+
+	if (readByte() != 0xFF || readByte() != SOI) return false;
+
+	for (;;)
+	{
+		const int marker = nextMarker();
+
+		switch (marker)
+		{
+		case SOF0:
+		case SOF1:
+			if (!readFrame()) return false;
+			break;
+
+		case DHT:
+			if (!readHuffmanTables()) return false;
+			break;
+
+		case DQT:
+			if (!readQuantizationTables()) return false;
+			break;
+
+		case DRI:
+		{
+			if (readWord() != 4) return false;
+			const int interval = readWord();
+			if (interval < 0) return false;
+			_restartInterval = interval;
+			break;
+		}
+
+		case SOS:
+			if (!readScan()) return false;
+			_headerRead = true;
+			return true;
+
+		case -1:
+		case EOI:
+			return false;
+
+		default:
+		{
+			//  Any other frame type - progressive, lossless, arithmetic coding.
+			if (marker > SOF1 && marker <= 0xCF) return false;
+
+			const int length = readWord();
+			if (length < 2 || !skip(length - 2)) return false;
+			break;
+		}
+		}
+	}
+}
+
+bool
+Waveshare_ILI9486_Jpeg::readFrame()
+{
+	const int length = readWord();
+	const int precision = readByte();
+	const int height = readWord();
+	const int width = readWord();
+	const int count = readByte();
+
+	//  A height of 0 means it's given at the end of the first scan - not supported.
+	if (precision != 8 || height <= 0 || width <= 0) return false;
+	if ((count != 1 && count != 3) || length != 8 + 3 * count) return false;
+
+	for (uint8_t i = 0; i < count; i++)
+	{
+		Component &component = _components[i];
+		const int id = readByte();
+		const int sampling = readByte();
+		const int quant = readByte();
+
+		if (id < 0 || sampling < 0 || quant < 0 || quant > 3) return false;
+		component.id = id;
+		component.h = sampling >> 4;
+		component.v = sampling & 0x0F;
+		component.quant = quant;
+	}
+
+	if (count == 1)
+	{
+		//  A single component scan isn't interleaved, the MCU is always one block.
+		_components[0].h = _components[0].v = 1;
+	}
+	else
+	{
+		//  Luma at up to twice the chroma resolution each way.
+		if (_components[0].h < 1 || _components[0].h > 2 ||
+			_components[0].v < 1 || _components[0].v > 2) return false;
+
+		for (uint8_t i = 1; i < count; i++)
+		{
+			if (_components[i].h != 1 || _components[i].v != 1) return false;
+		}
+	}
+
+	_width = width;
+	_height = height;
+	_componentCount = count;
+	_hMax = _components[0].h;
+	_vMax = _components[0].v;
+
+	return true;
+}
+
+bool
+Waveshare_ILI9486_Jpeg::readHuffmanTables()
+{
+	int length = readWord() - 2;
+
+	while (length > 0)
+	{
+		const int info = readByte();
+		if (info < 0 || (info >> 4) > 1 || (info & 0x0F) > 1) return false;
+
+		Huffman &table = _huffman[(info >> 4) * 2 + (info & 0x0F)];
+		uint8_t counts[16];
+		uint16_t total = 0;
+
+		for (uint8_t i = 0; i < 16; i++)
+		{
+			const int count = readByte();
+			if (count < 0) return false;
+			counts[i] = count;
+			total += count;
+		}
+		if (total > MAX_HUFFMAN_VALUES) return false;
+
+		for (uint8_t i = 0; i < total; i++)
+		{
+			const int value = readByte();
+			if (value < 0) return false;
+			table.values[i] = value;
+		}
+
+		//  Canonical codes - each length follows on from the one before.
+		uint32_t code = 0;
+		uint8_t index = 0;
+		for (uint8_t bits = 1; bits <= 16; bits++)
+		{
+			table.valuePtr[bits] = index;
+			table.minCode[bits] = code;
+			code += counts[bits - 1];
+			index += counts[bits - 1];
+			if (code > (uint32_t(1) << bits)) return false;
+			table.maxCode[bits] = (counts[bits - 1] != 0) ? int32_t(code) - 1 : -1;
+			code <<= 1;
+		}
+		table.defined = true;
+
+		length -= 17 + total;
+	}
+
+	return length == 0;
+}
+
+bool
+Waveshare_ILI9486_Jpeg::readQuantizationTables()
+{
+	int length = readWord() - 2;
+
+	while (length > 0)
+	{
+		const int info = readByte();
+		if (info < 0 || (info >> 4) > 1 || (info & 0x0F) > 3) return false;
+
+		const bool wide = (info >> 4) != 0;
+		uint16_t *pTable = _quant[info & 0x0F];
+
+		for (uint8_t i = 0; i < 64; i++)
+		{
+			const int value = wide ? readWord() : readByte();
+			if (value < 0) return false;
+			pTable[i] = value;
+		}
+		_quantDefined |= 1 << (info & 0x0F);
+
+		length -= wide ? 129 : 65;
+	}
+
+	return length == 0;
+}
+
+bool
+Waveshare_ILI9486_Jpeg::readScan()
+{
+	const int length = readWord();
+	const int count = readByte();
+
+	//  Baseline, with every component in the one scan.
+	if (_componentCount == 0 || count != _componentCount || length != 6 + 2 * count) return false;
+
+	for (uint8_t i = 0; i < count; i++)
+	{
+		Component &component = _components[i];
+		const int id = readByte();
+		const int tables = readByte();
+
+		if (id != component.id || tables < 0) return false;
+		component.dcTable = tables >> 4;
+		component.acTable = 2 + (tables & 0x0F);
+		if (component.dcTable > 1 || component.acTable > 3) return false;
+		if (!_huffman[component.dcTable].defined || !_huffman[component.acTable].defined) return false;
+		if ((_quantDefined & (1 << component.quant)) == 0) return false;
+	}
+
+	//  Spectral selection and successive approximation are for progressive files.
+	if (readByte() != 0 || readByte() != 63 || readByte() != 0) return false;
+
+	return true;
+}
+
+//  Tops the bit buffer up to at least 25 bits.  Bytes are unstuffed on the way, and
+//  once a marker turns up only zeros are added.
+void
+Waveshare_ILI9486_Jpeg::fillBits()
+{
+	while (_bitCount <= 24)
+	{
+		uint8_t byte = 0;
+
+		if (!_markerFound)
+		{
+			int c = readByte();
+
+			if (c == 0xFF)
+			{
+				do
+				{
+					c = readByte();
+				} while (c == 0xFF);
+
+				if (c == 0)
+				{
+					byte = 0xFF;
+				}
+				else
+				{
+					_markerFound = true;
+					_marker = (c < 0) ? 0 : c;
+				}
+			}
+			else if (c < 0)
+			{
+				//  Ran out of file with no EOI.
+				_markerFound = true;
+				_marker = 0;
+				_error = true;
+			}
+			else
+			{
+				byte = c;
+			}
+		}
+
+		_bitBuffer |= uint32_t(byte) << (24 - _bitCount);
+		_bitCount += 8;
+	}
+}
+
+uint16_t
+Waveshare_ILI9486_Jpeg::getBits(
+	uint8_t count)
+{
+	if (count == 0) return 0;
+
+	fillBits();
+	const uint16_t bits = _bitBuffer >> (32 - count);
+	_bitBuffer <<= count;
+	_bitCount -= count;
+
+	return bits;
+}
+
+uint8_t
+Waveshare_ILI9486_Jpeg::decodeHuffman(
+	uint8_t index)
+{
+	const Huffman &table = _huffman[index];
+
+	fillBits();
+	for (uint8_t bits = 1; bits <= 16; bits++)
+	{
+		const int32_t code = _bitBuffer >> (32 - bits);
+
+		if (code <= table.maxCode[bits])
+		{
+			_bitBuffer <<= bits;
+			_bitCount -= bits;
+			return table.values[table.valuePtr[bits] + code - table.minCode[bits]];
+		}
+	}
+
+	_error = true;
+	return 0;
+}
+
+//  Between restart intervals - drop the rest of the byte, find the RSTn marker and
+//  start the DC predictions over.
+bool
+Waveshare_ILI9486_Jpeg::restart()
+{
+	_bitBuffer = 0;
+	_bitCount = 0;
+
+	if (!_markerFound)
+	{
+		const int marker = nextMarker();
+		_marker = (marker < 0) ? 0 : marker;
+	}
+	if (_marker < RST0 || _marker > RST7) return false;
+
+	_markerFound = false;
+	for (uint8_t i = 0; i < _componentCount; i++)
+	{
+		_components[i].dcPredictor = 0;
+	}
+
+	return true;
+}
+
+//  Decodes one block's coefficients, dequantized, into '_block'.  With 'wantAC' FALSE
+//  the AC coefficients are read past but not stored.
+void
+Waveshare_ILI9486_Jpeg::decodeBlock(
+	uint8_t index,
+	bool wantAC)
+{
+	Component &component = _components[index];
+	const uint16_t *pQuant = _quant[component.quant];
+
+	memset(_block, 0, sizeof(_block));
+
+	//  Coefficients are range limited, see 'clampCoefficient()'.  Only bad data gets
+	//  near the limit.
+	const uint8_t dcSize = decodeHuffman(component.dcTable);
+	if (dcSize > 11)
+	{
+		_error = true;
+		return;
+	}
+	if (dcSize != 0)
+	{
+		component.dcPredictor += extend(getBits(dcSize), dcSize);
+	}
+	_block[0] = clampCoefficient(int32_t(component.dcPredictor) * pQuant[0]);
+
+	for (uint8_t k = 1; k < 64;)
+	{
+		const uint8_t symbol = decodeHuffman(component.acTable);
+		const uint8_t run = symbol >> 4;
+		const uint8_t size = symbol & 0x0F;
+
+		if (size == 0)
+		{
+			//  End of block, or a run of 16 zeros.
+			if (run != 15) break;
+			k += 16;
+			continue;
+		}
+
+		k += run;
+		if (k > 63 || size > 10)
+		{
+			_error = true;
+			return;
+		}
+
+		const int16_t value = extend(getBits(size), size);
+		if (wantAC)
+		{
+			_block[pgm_read_byte(zigzag + k)] = clampCoefficient(int32_t(value) * pQuant[k]);
+		}
+		k++;
+	}
+}
+
+//  Turns '_block' into samples, scaled down by 2^shift, and puts them in the MCU
+//  buffer for the component.  (bx, by) is the block within the MCU.
+void
+Waveshare_ILI9486_Jpeg::transformBlock(
+	uint8_t index,
+	uint8_t bx,
+	uint8_t by,
+	uint8_t shift)
+{
+	const uint8_t size = 8 >> shift;
+	uint8_t stride;
+	uint8_t *pOut;
+
+	if (index == 0)
+	{
+		stride = 16;
+		pOut = _luma + by * size * stride + bx * size;
+	}
+	else
+	{
+		stride = 8;
+		pOut = _chroma[index - 1];
+	}
+
+	switch (shift)
+	{
+	case 0:
+		inverseDct(_block, pOut, stride);
+		break;
+
+	case 1:
+		inverseDct4(_block, pOut, stride);
+		break;
+
+	case 2:
+		inverseDct2(_block, pOut, stride);
+		break;
+
+	default:
+		//  Just the average, which is the DC coefficient.
+		*pOut = clampSample(descale(_block[0], 3) + 128);
+		break;
+	}
+}
+
+//  4:2:0 chroma, scaled down, is kept at twice the resolution of the rest - the same
+//  size as the luma, so none of its detail is lost to replication.
+uint8_t
+Waveshare_ILI9486_Jpeg::chromaShift(
+	uint8_t shift) const
+{
+	return (shift > 0 && _hMax == 2 && _vMax == 2) ? shift - 1 : shift;
+}
+
+//  Color converts the MCU buffers to '_pixels', replicating the chroma samples.
+void
+Waveshare_ILI9486_Jpeg::convertMcu(
+	uint8_t shift)
+{
+	const uint8_t width = (8 * _hMax) >> shift;
+	const uint8_t height = (8 * _vMax) >> shift;
+	const uint8_t hShift = _hMax - 1 - (shift - chromaShift(shift));
+	const uint8_t vShift = _vMax - 1 - (shift - chromaShift(shift));
+	uint16_t *pOut = _pixels;
+
+	for (uint8_t y = 0; y < height; y++)
+	{
+		const uint8_t *pLuma = _luma + y * 16;
+
+		if (_componentCount == 1)
+		{
+			for (uint8_t x = 0; x < width; x++)
+			{
+				const uint8_t gray = pLuma[x];
+				*pOut++ = color565(gray, gray, gray);
+			}
+			continue;
+		}
+
+		const uint8_t *pBlue = _chroma[0] + (y >> vShift) * 8;
+		const uint8_t *pRed = _chroma[1] + (y >> vShift) * 8;
+
+		for (uint8_t x = 0; x < width; x++)
+		{
+			*pOut++ = yccTo565(pLuma[x], pBlue[x >> hShift], pRed[x >> hShift]);
+		}
+	}
+}
+
+bool
+Waveshare_ILI9486_Jpeg::decode(
+	WriteFunction write,
+	void *pContext,
+	int16_t x,
+	int16_t y,
+	Scale scale)
+{
+	if (!_headerRead && !readHeader()) return false;
+	//  The image data is read as it's decoded, so it's a one shot.
+	_headerRead = false;
+
+	_bitBuffer = 0;
+	_bitCount = 0;
+	_markerFound = false;
+	_marker = 0;
+	_error = false;
+	for (uint8_t i = 0; i < _componentCount; i++)
+	{
+		_components[i].dcPredictor = 0;
+	}
+
+	const uint8_t shift = scale;
+	const uint8_t mcuWidth = 8 * _hMax;
+	const uint8_t mcuHeight = 8 * _vMax;
+	const uint16_t mcusAcross = (_width + mcuWidth - 1) / mcuWidth;
+	const uint16_t mcusDown = (_height + mcuHeight - 1) / mcuHeight;
+	const int16_t outWidth = mcuWidth >> shift;
+	const int16_t outHeight = mcuHeight >> shift;
+	const int32_t imageWidth = width(scale);
+	const int32_t imageHeight = height(scale);
+	uint16_t untilRestart = _restartInterval;
+
+	for (uint16_t mcuY = 0; mcuY < mcusDown; mcuY++)
+	{
+		for (uint16_t mcuX = 0; mcuX < mcusAcross; mcuX++)
+		{
+			if (_restartInterval != 0)
+			{
+				if (untilRestart == 0)
+				{
+					if (!restart()) return false;
+					untilRestart = _restartInterval;
+				}
+				untilRestart--;
+			}
+
+			for (uint8_t i = 0; i < _componentCount; i++)
+			{
+				const Component &component = _components[i];
+
+				const uint8_t blockShift = (i == 0) ? shift : chromaShift(shift);
+
+				for (uint8_t by = 0; by < component.v; by++)
+				{
+					for (uint8_t bx = 0; bx < component.h; bx++)
+					{
+						decodeBlock(i, blockShift < 3);
+						transformBlock(i, bx, by, blockShift);
+					}
+				}
+			}
+			if (_error) return false;
+
+			convertMcu(shift);
+
+			//  Edge MCUs are cut down to the image, and anything beyond where an int16_t
+			//  can reach is decoded but dropped.
+			const int32_t left = int32_t(mcuX) * outWidth;
+			const int32_t top = int32_t(mcuY) * outHeight;
+			if (x + left > INT16_MAX || y + top > INT16_MAX) continue;
+
+			const int16_t w = (left + outWidth <= imageWidth) ? outWidth : imageWidth - left;
+			const int16_t h = (top + outHeight <= imageHeight) ? outHeight : imageHeight - top;
+			write(pContext, x + left, y + top, w, h, _pixels, outWidth);
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,221 @@
+//  Waveshare ILI9486 JPEG
+//  - Streaming baseline JPEG decoder, drawing straight to the screen.
+//
+//  Photos and camera snapshots, from an SD card or memory, with no decoded frame
+//  anywhere.  The file is read through a small buffer, each MCU (8x8 to 16x16 pixels)
+//  is decoded to RGB565 and sent as its own window, and the next one reuses the same
+//  memory.  All the working memory is in the object, about 3 KB - fine on a Mega or
+//  an ESP, but too much for an Uno.
+//
+//  Baseline (SOF0 / SOF1, 8 bit, Huffman) only, greyscale or YCbCr with 4:4:4, 4:2:2,
+//  4:4:0 or 4:2:0 chroma.  Progressive and arithmetic coded files are refused.  The
+//  IDCT and color conversion are integer, and match libjpeg's 'islow' IDCT with plain
+//  (not 'fancy') chroma upsampling.  Scaling by 1/2, 1/4 or 1/8 on the way out uses
+//  libjpeg's reduced size IDCTs, so matches libjpeg's own scaling too.  At 1/8 luma is
+//  just each block's DC value, skipping the IDCT, so it's a quick preview.
+//
+//      Waveshare_ILI9486_Jpeg jpeg;
+//      jpeg.begin(readFromFile, &file);
+//      if (jpeg.readHeader())
+//      {
+//          jpeg.draw(tft, 0, 0, Waveshare_ILI9486_Jpeg::SCALE_1_2);
+//      }
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_JPEG_h
+#define _WAVESHARE_ILI9486_JPEG_h
+
+class Waveshare_ILI9486_Jpeg
+{
+public:
+	//  Fills 'pBuffer' with up to 'count' bytes of the file.  Returns how many, 0 at the
+	//  end.
+	typedef size_t (*ReadFunction)(void *pContext, uint8_t *pBuffer, size_t count);
+
+	//  Gets each decoded block, 'w' x 'h' pixels with rows 'stride' apart, already cut
+	//  down to the image edges.  (x, y) is where it goes.
+	typedef void (*WriteFunction)(void *pContext, int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride);
+
+	enum Scale : uint8_t
+	{
+		SCALE_1,
+		SCALE_1_2,
+		SCALE_1_4,
+		SCALE_1_8
+	};
+
+	Waveshare_ILI9486_Jpeg();
+
+	//  Where the file comes from - a read function, or a complete file in memory.
+	void begin(ReadFunction read, void *pContext);
+	void begin(const uint8_t *pData, size_t size);
+
+	//  Reads up to the start of the image data.  Returns FALSE if it isn't a JPEG, or
+	//  isn't one this can decode.
+	bool readHeader();
+	uint16_t width() const { return _width; }
+	uint16_t height() const { return _height; }
+	//  Size after scaling, rounded up.
+	uint16_t width(Scale scale) const { return (_width + (1 << scale) - 1) >> scale; }
+	uint16_t height(Scale scale) const { return (_height + (1 << scale) - 1) >> scale; }
+
+	//  Decodes the image, with its top left corner at (x, y), reading the header first
+	//  if 'readHeader()' hasn't been.  Returns FALSE if the data is bad - whatever was
+	//  decoded up to then has been drawn.
+	bool decode(WriteFunction write, void *pContext, int16_t x, int16_t y, Scale scale = SCALE_1);
+
+	//  Decodes onto the display, clipped like 'drawColorsRegion()', under one bus hold.
+	//  Reading from a function, the hold calls 'yieldBus()' before every refill, so an
+	//  SD card on the same bus is fine.
+	template<class Display>
+	bool draw(Display &display, int16_t x, int16_t y, Scale scale = SCALE_1)
+	{
+		YieldingSource source = {_read, _pContext, &yieldBus<Display>, &display};
+		const bool wrap = (_read != nullptr) && (_read != &readMemory);
+		if (wrap)
+		{
+			_read = &yieldingRead;
+			_pContext = &source;
+		}
+
+		display.beginBusHold();
+		const bool ok = decode(&drawBlock<Display>, &display, x, y, scale);
+		display.endBusHold();
+
+		if (wrap)
+		{
+			_read = source.read;
+			_pContext = source.pContext;
+		}
+		return ok;
+	}
+
+private:
+	template<class Display>
+	static void drawBlock(void *pContext, int16_t x, int16_t y, int16_t w, int16_t h,
+		const uint16_t *pColors, int16_t stride)
+	{
+		static_cast<Display *>(pContext)->drawColorsRegion(x, y, pColors, stride, 0, 0, w, h);
+	}
+
+	template<class Display>
+	static void yieldBus(void *pDisplay)
+	{
+		static_cast<Display *>(pDisplay)->yieldBus();
+	}
+
+	//  The caller's read function, wrapped by 'draw()'.
+	struct YieldingSource
+	{
+		ReadFunction read;
+		void *pContext;
+		void (*yield)(void *pDisplay);
+		void *pDisplay;
+	};
+
+	static size_t readMemory(void *pContext, uint8_t *pBuffer, size_t count);
+	//  Lets go of the LCD, then calls the wrapped read function.
+	static size_t yieldingRead(void *pContext, uint8_t *pBuffer, size_t count);
+
+	//  Input.
+	int readByte();
+	int readWord();
+	bool skip(uint16_t count);
+	int nextMarker();
+
+	//  Headers.
+	bool readFrame();
+	bool readHuffmanTables();
+	bool readQuantizationTables();
+	bool readScan();
+
+	//  Entropy decoding.
+	void fillBits();
+	uint16_t getBits(uint8_t count);
+	uint8_t decodeHuffman(uint8_t table);
+	bool restart();
+	void decodeBlock(uint8_t component, bool wantAC);
+
+	//  Pixels.
+	void transformBlock(uint8_t component, uint8_t bx, uint8_t by, uint8_t shift);
+	uint8_t chromaShift(uint8_t shift) const;
+	void convertMcu(uint8_t shift);
+
+	static constexpr uint8_t MAX_SCAN_COMPONENTS = 3;
+	static constexpr uint8_t MAX_HUFFMAN_VALUES = 162;
+	static constexpr uint8_t INPUT_SIZE = 64;
+
+	struct Huffman
+	{
+		int32_t maxCode[17];        //  Largest code of each length, -1 if none.
+		uint16_t minCode[17];
+		uint8_t valuePtr[17];       //  Index in 'values' of the first code of each length.
+		uint8_t values[MAX_HUFFMAN_VALUES];
+		bool defined;
+	};
+
+	struct Component
+	{
+		uint8_t id;
+		uint8_t h, v;               //  Sampling factors.
+		uint8_t quant;
+		uint8_t dcTable, acTable;   //  Index into '_huffman' - DC are 0 - 1, AC 2 - 3.
+		int16_t dcPredictor;
+	};
+
+	ReadFunction _read;
+	void *_pContext;
+	const uint8_t *_pMemory;
+	size_t _memoryLeft;
+
+	uint8_t _input[INPUT_SIZE];
+	uint8_t _inputPos, _inputLength;
+
+	uint32_t _bitBuffer;
+	uint8_t _bitCount;
+	//  Set when the entropy coded data has run into a marker (or the end).  Zeros are
+	//  read from then on.
+	bool _markerFound;
+	uint8_t _marker;
+	bool _error;
+
+	bool _headerRead;
+	uint16_t _width, _height;
+	uint8_t _componentCount;
+	uint8_t _hMax, _vMax;
+	uint16_t _restartInterval;
+	Component _components[MAX_SCAN_COMPONENTS];
+	Huffman _huffman[4];
+	uint16_t _quant[4][64];     //  Zigzag order, as in the file.
+	uint8_t _quantDefined;      //  Bit per table.
+
+	int16_t _block[64];         //  Dequantized, natural order.
+	//  One MCU of samples, Y then Cb and Cr, then the same as RGB565.
+	uint8_t _luma[16 * 16];
+	uint8_t _chroma[2][8 * 8];
+	uint16_t _pixels[16 * 16];
+};
+
+#endif
@@ -0,0 +1,300 @@
+//  Waveshare ILI9486 numeric field
+//  - Fixed layout readout that only redraws the character cells that changed.
+//
+//  Most screen updates are numbers ticking over.  Clearing the field and printing the
+//  whole value again costs a fill plus a window per text pixel.  This remembers what
+//  it last showed, and each changed cell is rendered into a small 1 bit canvas and sent
+//  as a single opaque window, so '21.4' -> '21.5' is one small window.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_NUMERICFIELD_h
+#define _WAVESHARE_ILI9486_NUMERICFIELD_h
+
+//  MAX_CELLS is the widest field the object can hold, 'cells' in the constructor is the
+//  width actually used.
+template<class Display, uint8_t MAX_CELLS = 12>
+class Waveshare_ILI9486_NumericField
+{
+public:
+	//  Uses the built in 6x8 font, scaled by 'textSize'.  The field is 'cells'
+	//  characters wide, with its top left corner at (x, y).
+	Waveshare_ILI9486_NumericField(Display &display, int16_t x, int16_t y,
+		uint8_t cells, uint8_t textSize = 1);
+	~Waveshare_ILI9486_NumericField();
+
+	//  For a GFXfont, the cell size and baseline (from the top of the cell) have to be
+	//  given - use the widest glyph in the font.  Forces a full redraw.
+	void setFont(const GFXfont *pFont, uint8_t cellW, uint8_t cellH, int8_t baseline);
+
+	//  Forces a full redraw.
+	void setColors(uint16_t color, uint16_t bg);
+
+	//  Right aligned by default, which suits numbers.  Forces a full redraw.
+	void setRightAligned(bool right);
+
+	//  Text longer than the field is cut off on the right.  Like Print, doubles that
+	//  aren't numbers or don't fit 32 bits once scaled show as "nan", "inf" or "ovf".
+	void print(const char *pText);
+	void print(long value);
+	void print(double value, uint8_t decimals);
+
+	//  Next print redraws every cell, for example after the screen has been cleared.
+	void invalidate();
+
+	int16_t width() const { return (int16_t)_cells * _cellW; }
+	int16_t height() const { return _cellH; }
+
+private:
+	//  Returns TRUE if the canvas is usable.
+	bool prepareCanvas();
+	void drawCell(uint8_t cell, char c);
+
+	Display &_display;
+	int16_t _x, _y;
+	uint8_t _cells;
+	uint8_t _textSize;
+	const GFXfont *_pFont;
+	uint8_t _cellW, _cellH;
+	int8_t _baseline;
+	uint16_t _color, _bg;
+	bool _rightAligned;
+	GFXcanvas1 *_pCanvas;
+
+	//  What each cell is showing now.  0 means unknown, so it will be redrawn.
+	char _shown[MAX_CELLS];
+};
+
+
+////  Template implementation follows
+template<class Display, uint8_t MAX_CELLS>
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::Waveshare_ILI9486_NumericField(
+	Display &display, int16_t x, int16_t y, uint8_t cells, uint8_t textSize)
+	:_display(display), _x(x), _y(y),
+	_cells(cells > MAX_CELLS ? MAX_CELLS : cells),
+	_textSize(textSize), _pFont(nullptr),
+	_cellW(6 * textSize), _cellH(8 * textSize), _baseline(0),
+	_color(0xFFFF), _bg(0x0000), _rightAligned(true), _pCanvas(nullptr)
+{
+	invalidate();
+}
+
+template<class Display, uint8_t MAX_CELLS>
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::~Waveshare_ILI9486_NumericField()
+{
+	delete _pCanvas;
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::setFont(
+	const GFXfont *pFont, uint8_t cellW, uint8_t cellH, int8_t baseline)
+{
+	_pFont = pFont;
+	_cellW = cellW;
+	_cellH = cellH;
+	_baseline = baseline;
+
+	//  Different cell size, so the canvas has to be remade.
+	delete _pCanvas;
+	_pCanvas = nullptr;
+	invalidate();
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::setColors(uint16_t color, uint16_t bg)
+{
+	_color = color;
+	_bg = bg;
+	invalidate();
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::setRightAligned(bool right)
+{
+	_rightAligned = right;
+	invalidate();
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::invalidate()
+{
+	memset(_shown, 0, sizeof(_shown));
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::print(const char *pText)
+{
+	uint8_t length = strlen(pText);
+	if (length > _cells) length = _cells;
+	const uint8_t pad = _rightAligned ? _cells - length : 0;
+
+	for (uint8_t cell = 0; cell < _cells; cell++)
+	{
+		char c = ' ';
+		if ((cell >= pad) && (cell < pad + length))
+		{
+			c = pText[cell - pad];
+		}
+
+		if (c != _shown[cell])
+		{
+			drawCell(cell, c);
+		}
+	}
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::print(long value)
+{
+	//  Built backwards from the ones digit.
+	char text[12];
+	char *p = text + sizeof(text) - 1;
+	*p = '\0';
+
+	unsigned long magnitude = (value < 0) ? 0UL - (unsigned long)value : (unsigned long)value;
+	do
+	{
+		*--p = '0' + (magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+
+	if (value < 0)
+	{
+		*--p = '-';
+	}
+	print(p);
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::print(double value, uint8_t decimals)
+{
+	//  What Print::printFloat shows for values it can't convert.
+	if (isnan(value))
+	{
+		print("nan");
+		return;
+	}
+	if (isinf(value))
+	{
+		print("inf");
+		return;
+	}
+
+	if (decimals > 6) decimals = 6;
+
+	long scale = 1;
+	for (uint8_t i = 0; i < decimals; i++)
+	{
+		scale *= 10;
+	}
+
+	//  Round once, then split - avoids '1.10' showing up as '1.09'.
+	const bool negative = value < 0;
+	const double rounded = (negative ? -value : value) * scale + 0.5;
+
+	//  Converting anything past 32 bits would be undefined.  This is the largest float
+	//  below 2^32, as doubles are floats on AVR.
+	if (rounded > 4294967040.0)
+	{
+		print("ovf");
+		return;
+	}
+	unsigned long scaled = (unsigned long)rounded;
+
+	char text[24];
+	char *p = text + sizeof(text) - 1;
+	*p = '\0';
+	for (uint8_t i = 0; i < decimals; i++)
+	{
+		*--p = '0' + (scaled % 10);
+		scaled /= 10;
+	}
+	if (decimals > 0)
+	{
+		*--p = '.';
+	}
+	do
+	{
+		*--p = '0' + (scaled % 10);
+		scaled /= 10;
+	} while (scaled > 0);
+
+	if (negative)
+	{
+		*--p = '-';
+	}
+	print(p);
+}
+
+template<class Display, uint8_t MAX_CELLS>
+bool
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::prepareCanvas()
+{
+	if (_pCanvas == nullptr)
+	{
+		_pCanvas = new GFXcanvas1(_cellW, _cellH);
+		if ((_pCanvas == nullptr) || (_pCanvas->getBuffer() == nullptr))
+		{
+			delete _pCanvas;
+			_pCanvas = nullptr;
+			return false;
+		}
+		_pCanvas->setTextWrap(false);
+	}
+	return true;
+}
+
+template<class Display, uint8_t MAX_CELLS>
+void
+Waveshare_ILI9486_NumericField<Display, MAX_CELLS>::drawCell(uint8_t cell, char c)
+{
+	const int16_t x = _x + (int16_t)cell * _cellW;
+
+	if (c == ' ')
+	{
+		//  Blank cells don't need the canvas.
+		_display.fillRect(x, _y, _cellW, _cellH, _bg);
+	}
+	else
+	{
+		if (!prepareCanvas()) return;
+
+		_pCanvas->fillScreen(0);
+		_pCanvas->setFont(_pFont);
+		_pCanvas->setTextSize(_textSize);
+		_pCanvas->setCursor(0, _baseline);
+		_pCanvas->write(c);
+
+		_display.drawBitmap(x, _y, _pCanvas->getBuffer(), _cellW, _cellH, _color, _bg);
+	}
+	_shown[cell] = c;
+}
+
+#endif
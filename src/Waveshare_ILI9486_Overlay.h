@@ -0,0 +1,277 @@
+//  Waveshare ILI9486 overlay
+//  - Cursors, popups and drag handles that move without redrawing what's under them.
+//
+//  The panel can't be read back, so whatever an overlay covered has to be put back
+//  from somewhere when it moves.  The application says where: a solid color, part of
+//  a backing bitmap, or a callback that repaints any rectangle of the screen.  Moving
+//  draws the overlay at its new position, then repaints only the strips of the old
+//  position it no longer covers - at most four rectangles, all under one bus hold.
+//
+//  The overlay has to be opaque over its whole rectangle; its own content comes from
+//  an image or from a callback.  Everything is drawn through the display, so the
+//  current clip and origin apply.
+//
+//      Waveshare_ILI9486_Overlay<Waveshare_ILI9486> cursor(tft, 16, 16);
+//      cursor.setImage(cursorImage);
+//      cursor.setUnderlay(BLACK);
+//      cursor.moveTo(p.x - 8, p.y - 8);
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_OVERLAY_h
+#define _WAVESHARE_ILI9486_OVERLAY_h
+
+template<class Display>
+class Waveshare_ILI9486_Overlay
+{
+public:
+	//  Paints the (x, y, w, h) rectangle of the screen - for the overlay, that's the
+	//  whole overlay at its current position.
+	typedef void (*PaintFunction)(void *pContext, Display &display,
+		int16_t x, int16_t y, int16_t w, int16_t h);
+
+	Waveshare_ILI9486_Overlay(Display &display, int16_t w, int16_t h);
+
+	//  What the overlay looks like - a 'w' x 'h' image, or a callback.  Call 'redraw()'
+	//  if it changes while shown.
+	void setImage(const uint16_t *pColors);
+	void setPainter(PaintFunction paint, void *pContext);
+
+	//  What's under the overlay.  The bitmap covers the (x, y, w, h) rectangle of the
+	//  screen; anything the overlay uncovers outside that is left as it is.
+	void setUnderlay(uint16_t color);
+	void setUnderlay(const uint16_t *pBitmap, int16_t x, int16_t y, int16_t w, int16_t h);
+	void setUnderlay(PaintFunction paint, void *pContext);
+
+	//  Shows the overlay with its top left corner at (x, y), or moves it there.
+	void moveTo(int16_t x, int16_t y);
+	//  Puts back everything the overlay covers.
+	void hide();
+	void redraw();
+
+	bool isVisible() const { return _visible; }
+	int16_t x() const { return _x; }
+	int16_t y() const { return _y; }
+	int16_t width() const { return _w; }
+	int16_t height() const { return _h; }
+
+private:
+	enum Underlay : uint8_t
+	{
+		UNDERLAY_COLOR,
+		UNDERLAY_BITMAP,
+		UNDERLAY_FUNCTION
+	};
+
+	void paintOverlay();
+	void paintUnderlay(int16_t x, int16_t y, int16_t w, int16_t h);
+
+	Display &_display;
+	int16_t _x, _y, _w, _h;
+	bool _visible;
+
+	const uint16_t *_pImage;
+	PaintFunction _paint;
+	void *_pPaintContext;
+
+	Underlay _underlay;
+	uint16_t _color;
+	const uint16_t *_pBitmap;
+	int16_t _bitmapX, _bitmapY, _bitmapW, _bitmapH;
+	PaintFunction _paintUnderlay;
+	void *_pUnderlayContext;
+};
+
+
+////  Template implementation follows
+template<class Display>
+Waveshare_ILI9486_Overlay<Display>::Waveshare_ILI9486_Overlay(Display &display, int16_t w, int16_t h)
+	:_display(display), _x(0), _y(0), _w(w), _h(h), _visible(false),
+	_pImage(nullptr), _paint(nullptr), _pPaintContext(nullptr),
+	_underlay(UNDERLAY_COLOR), _color(0), _pBitmap(nullptr),
+	_bitmapX(0), _bitmapY(0), _bitmapW(0), _bitmapH(0),
+	_paintUnderlay(nullptr), _pUnderlayContext(nullptr)
+{
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::setImage(const uint16_t *pColors)
+{
+	_pImage = pColors;
+	_paint = nullptr;
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::setPainter(PaintFunction paint, void *pContext)
+{
+	_paint = paint;
+	_pPaintContext = pContext;
+	_pImage = nullptr;
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::setUnderlay(uint16_t color)
+{
+	_underlay = UNDERLAY_COLOR;
+	_color = color;
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::setUnderlay(const uint16_t *pBitmap, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	_underlay = UNDERLAY_BITMAP;
+	_pBitmap = pBitmap;
+	_bitmapX = x;
+	_bitmapY = y;
+	_bitmapW = w;
+	_bitmapH = h;
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::setUnderlay(PaintFunction paint, void *pContext)
+{
+	_underlay = UNDERLAY_FUNCTION;
+	_paintUnderlay = paint;
+	_pUnderlayContext = pContext;
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::moveTo(int16_t x, int16_t y)
+{
+	if (_visible && (x == _x) && (y == _y)) return;
+
+	const int16_t oldX = _x;
+	const int16_t oldY = _y;
+	const bool wasVisible = _visible;
+
+	_x = x;
+	_y = y;
+	_visible = true;
+
+	_display.beginBusHold();
+
+	//  New position first, so there's never a moment with no overlay on screen.
+	paintOverlay();
+
+	if (wasVisible)
+	{
+		//  The overlap of the old and new rectangles.  If they don't overlap, all of the
+		//  old one is uncovered.
+		const int16_t left = (oldX > x) ? oldX : x;
+		const int16_t right = (oldX + _w < x + _w) ? oldX + _w : x + _w;
+		const int16_t top = (oldY > y) ? oldY : y;
+		const int16_t bottom = (oldY + _h < y + _h) ? oldY + _h : y + _h;
+
+		if ((left >= right) || (top >= bottom))
+		{
+			paintUnderlay(oldX, oldY, _w, _h);
+		}
+		else
+		{
+			//  Full width strips above and below the overlap, then the sides of it.
+			if (oldY < top) paintUnderlay(oldX, oldY, _w, top - oldY);
+			if (oldY + _h > bottom) paintUnderlay(oldX, bottom, _w, oldY + _h - bottom);
+			if (oldX < left) paintUnderlay(oldX, top, left - oldX, bottom - top);
+			if (oldX + _w > right) paintUnderlay(right, top, oldX + _w - right, bottom - top);
+		}
+	}
+
+	_display.endBusHold();
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::hide()
+{
+	if (!_visible) return;
+
+	_visible = false;
+	_display.beginBusHold();
+	paintUnderlay(_x, _y, _w, _h);
+	_display.endBusHold();
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::redraw()
+{
+	if (!_visible) return;
+
+	_display.beginBusHold();
+	paintOverlay();
+	_display.endBusHold();
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::paintOverlay()
+{
+	if (_pImage != nullptr)
+	{
+		_display.drawColorsRegion(_x, _y, _pImage, _w, 0, 0, _w, _h);
+	}
+	else if (_paint != nullptr)
+	{
+		_paint(_pPaintContext, _display, _x, _y, _w, _h);
+	}
+}
+
+template<class Display>
+void
+Waveshare_ILI9486_Overlay<Display>::paintUnderlay(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	switch (_underlay)
+	{
+	case UNDERLAY_COLOR:
+		_display.fillRect(x, y, w, h, _color);
+		break;
+
+	case UNDERLAY_BITMAP:
+	{
+		if (_pBitmap == nullptr) break;
+
+		//  Just the part the bitmap covers.
+		const int16_t left = (x > _bitmapX) ? x : _bitmapX;
+		const int16_t top = (y > _bitmapY) ? y : _bitmapY;
+		const int16_t right = (x + w < _bitmapX + _bitmapW) ? x + w : _bitmapX + _bitmapW;
+		const int16_t bottom = (y + h < _bitmapY + _bitmapH) ? y + h : _bitmapY + _bitmapH;
+		if ((left >= right) || (top >= bottom)) break;
+
+		_display.drawColorsRegion(left, top, _pBitmap, _bitmapW, left - _bitmapX, top - _bitmapY,
+			right - left, bottom - top);
+		break;
+	}
+
+	case UNDERLAY_FUNCTION:
+		if (_paintUnderlay != nullptr) _paintUnderlay(_pUnderlayContext, _display, x, y, w, h);
+		break;
+	}
+}
+
+#endif
@@ -0,0 +1,239 @@
+//  Waveshare ILI9486 render queue
+//  - Cooperative, time-budgeted drawing for boards without an RTOS (AVR, ESP8266).
+//
+//  Drawing jobs are queued, then 'service(budget_us)' is called from 'loop()'.  Each
+//  call works through the queue until the time budget is spent, so a full screen redraw
+//  is spread over many passes through 'loop()' instead of stalling it for 100+ ms.
+//  Fills and blits are split into bands of rows, so even a single full screen fill
+//  only holds the bus for a slice at a time.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_RENDERQUEUE_h
+#define _WAVESHARE_ILI9486_RENDERQUEUE_h
+
+//  'Display' is normally a Waveshare_ILI9486 (or another Waveshare_ILI9486_Template).
+//  QUEUE_SIZE jobs are held in a fixed array, nothing is allocated.
+template<class Display, uint8_t QUEUE_SIZE = 8>
+class Waveshare_ILI9486_RenderQueue
+{
+public:
+	//  User jobs.  Called once per slice until they return TRUE.  'step' counts up
+	//  from 0, so a callback can do its drawing in pieces (one widget, one row of
+	//  tiles...) and keep itself within the budget.
+	typedef bool (*RenderCallback)(Display &display, void *pContext, uint16_t step);
+
+	Waveshare_ILI9486_RenderQueue(Display &display);
+
+	//  Higher priority jobs are run first.  Jobs of the same priority run in the order
+	//  they were queued.  These return FALSE if the queue is full.
+	bool queueFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color,
+		uint8_t priority = 0);
+	//  'pColors' must stay valid until the job is finished.
+	bool queueColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors,
+		uint8_t priority = 0);
+	bool queueCallback(RenderCallback callback, void *pContext, uint8_t priority = 0);
+
+	//  Run queued jobs until 'budget_us' microseconds have passed.  At least one slice
+	//  is always run, so the queue makes progress even with a tiny budget.  Returns TRUE
+	//  when the queue is empty.
+	bool service(uint32_t budget_us);
+
+	uint8_t pending() const { return _count; }
+	void clear() { _count = 0; }
+
+	//  Approximate number of pixels sent per slice of a fill or blit.  AVR SPI tops out
+	//  at F_CPU / 2, so on a Mega (8 MHz) this is a little over 2 ms of bus time.  At
+	//  the ESP32's 20 MHz it is under 1 ms.
+	static constexpr uint16_t SLICE_PIXELS = 1024;
+
+private:
+	enum JobType : uint8_t
+	{
+		JobFill,
+		JobColors,
+		JobCallback
+	};
+
+	struct Job
+	{
+		JobType type;
+		uint8_t priority;
+		int16_t x, y, w, h;
+		uint16_t color;
+		uint16_t progress;      //  Rows done for fills and blits, steps for callbacks.
+		uint16_t *pColors;
+		RenderCallback callback;
+		void *pContext;
+	};
+
+	bool queue(const Job &job);
+	//  Returns TRUE if the job is finished.
+	bool runSlice(Job &job);
+	void remove(uint8_t index);
+
+	Display &_display;
+	Job _jobs[QUEUE_SIZE];
+	uint8_t _count;
+};
+
+
+////  Template implementation follows
+template<class Display, uint8_t QUEUE_SIZE>
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::Waveshare_ILI9486_RenderQueue(
+	Display &display)
+	:_display(display), _count(0)
+{
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::queueFillRect(
+	int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint8_t priority)
+{
+	Job job = {};
+	job.type = JobFill;
+	job.priority = priority;
+	job.x = x; job.y = y; job.w = w; job.h = h;
+	job.color = color;
+	return queue(job);
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::queueColors(
+	int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors, uint8_t priority)
+{
+	Job job = {};
+	job.type = JobColors;
+	job.priority = priority;
+	job.x = x; job.y = y; job.w = w; job.h = h;
+	job.pColors = pColors;
+	return queue(job);
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::queueCallback(
+	RenderCallback callback, void *pContext, uint8_t priority)
+{
+	Job job = {};
+	job.type = JobCallback;
+	job.priority = priority;
+	job.callback = callback;
+	job.pContext = pContext;
+	return queue(job);
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::queue(const Job &job)
+{
+	if (_count >= QUEUE_SIZE)
+	{
+		return false;
+	}
+
+	//  Nothing to draw?  Then it's already done.
+	if ((job.type != JobCallback) && ((job.w <= 0) || (job.h <= 0)))
+	{
+		return true;
+	}
+
+	_jobs[_count++] = job;
+	return true;
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+void
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::remove(uint8_t index)
+{
+	//  Shuffle down to keep the jobs in the order they were queued.
+	for (uint8_t i = index + 1; i < _count; i++)
+	{
+		_jobs[i - 1] = _jobs[i];
+	}
+	_count--;
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::runSlice(Job &job)
+{
+	if (job.type == JobCallback)
+	{
+		return job.callback(_display, job.pContext, job.progress++);
+	}
+
+	//  Whole rows only, so each slice is still a single address window.
+	int16_t rows = SLICE_PIXELS / job.w;
+	if (rows < 1) rows = 1;
+	if (rows > job.h - (int16_t)job.progress) rows = job.h - job.progress;
+
+	if (job.type == JobFill)
+	{
+		_display.fillRect(job.x, job.y + job.progress, job.w, rows, job.color);
+	}
+	else
+	{
+		_display.drawColors(job.x, job.y + job.progress, job.w, rows,
+			job.pColors + (uint32_t)job.progress * (uint32_t)job.w);
+	}
+
+	job.progress += rows;
+	return (int16_t)job.progress >= job.h;
+}
+
+template<class Display, uint8_t QUEUE_SIZE>
+bool
+Waveshare_ILI9486_RenderQueue<Display, QUEUE_SIZE>::service(uint32_t budget_us)
+{
+	const unsigned long start = micros();
+
+	while (_count > 0)
+	{
+		//  Highest priority wins, earliest queued breaks ties.
+		uint8_t next = 0;
+		for (uint8_t i = 1; i < _count; i++)
+		{
+			if (_jobs[i].priority > _jobs[next].priority)
+			{
+				next = i;
+			}
+		}
+
+		if (runSlice(_jobs[next]))
+		{
+			remove(next);
+		}
+
+		if ((unsigned long)(micros() - start) >= budget_us)
+		{
+			break;
+		}
+	}
+
+	return _count == 0;
+}
+
+#endif
@@ -0,0 +1,307 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <Arduino.h>
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+
+#include "Waveshare_ILI9486.h"
+#include "Waveshare_ILI9486_RenderTask.h"
+
+
+namespace
+{
+	enum RenderOp : uint8_t
+	{
+		OpFillRect,
+		OpColors,
+		OpRotation,
+		OpInvert,
+		OpIdle,
+		OpFence
+	};
+
+	//  Clip to the screen, same rules as Waveshare_ILI9486_Template::writeFillRect.
+	//  Returns FALSE if nothing is left.
+	bool clip(int16_t &x, int16_t &y, int16_t &w, int16_t &h, int16_t width, int16_t height)
+	{
+		if (w < 0)
+		{
+			w = -w;
+			x -= w;
+		}
+		if (h < 0)
+		{
+			h = -h;
+			y -= h;
+		}
+		if (x < 0)
+		{
+			w += x;
+			x = 0;
+		}
+		if (y < 0)
+		{
+			h += y;
+			y = 0;
+		}
+		if (x + w > width) w = width - x;
+		if (y + h > height) h = height - y;
+
+		return (w > 0) && (h > 0);
+	}
+}
+
+
+Waveshare_ILI9486_RenderTask::Waveshare_ILI9486_RenderTask()
+	:_task(nullptr), _blocking(true), _rotation(0), _fenceIssued(0), _fenceDone(0)
+{
+}
+
+bool
+Waveshare_ILI9486_RenderTask::begin(uint8_t core, UBaseType_t priority, uint32_t stackSize)
+{
+	if (_task != nullptr)
+	{
+		return true;
+	}
+
+	return xTaskCreatePinnedToCore(taskEntry, "ILI9486", stackSize, this, priority,
+		&_task, core) == pdPASS;
+}
+
+bool
+Waveshare_ILI9486_RenderTask::post(const Waveshare_ILI9486_Command &command)
+{
+	//  Not started, or 'begin()' failed - there's nobody to drain the ring.
+	if (_task == nullptr)
+	{
+		return false;
+	}
+
+	while (!_ring.push(command))
+	{
+		if (!_blocking)
+		{
+			return false;
+		}
+
+		//  Backpressure - the render task is at least RING_SIZE commands behind.
+		vTaskDelay(1);
+	}
+
+	//  Notifications count, so a wakeup can't be lost between the render task
+	//  finding the ring empty and going to sleep.
+	xTaskNotifyGive(_task);
+	return true;
+}
+
+bool
+Waveshare_ILI9486_RenderTask::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	if (!clip(x, y, w, h, width(), height()))
+	{
+		return true;
+	}
+
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpFillRect;
+	command.x = x; command.y = y; command.w = w; command.h = h;
+	command.color = color;
+	return post(command);
+}
+
+bool
+Waveshare_ILI9486_RenderTask::fillScreen(uint16_t color)
+{
+	return fillRect(0, 0, width(), height(), color);
+}
+
+bool
+Waveshare_ILI9486_RenderTask::drawColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors)
+{
+	if ((w <= 0) || (h <= 0))
+	{
+		return true;
+	}
+
+	//  The command carries the source stride, so a blit hanging off the screen just
+	//  starts further in and skips the hidden columns.
+	const int16_t stride = w;
+	const int16_t left = x;
+	const int16_t top = y;
+	if (!clip(x, y, w, h, width(), height()))
+	{
+		return true;
+	}
+
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpColors;
+	command.x = x; command.y = y; command.w = w; command.h = h;
+	command.stride = stride;
+	command.pColors = pColors + (int32_t)(y - top) * stride + (x - left);
+	return post(command);
+}
+
+bool
+Waveshare_ILI9486_RenderTask::setRotation(uint8_t r)
+{
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpRotation;
+	command.arg = r & 0x03;
+	if (!post(command))
+	{
+		return false;
+	}
+
+	//  Later commands are clipped with the new rotation, and they'll reach the panel
+	//  after it, so this is safe to change now.
+	_rotation = r & 0x03;
+	return true;
+}
+
+bool
+Waveshare_ILI9486_RenderTask::invertDisplay(bool i)
+{
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpInvert;
+	command.arg = i;
+	return post(command);
+}
+
+bool
+Waveshare_ILI9486_RenderTask::setIdleMode(bool idle)
+{
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpIdle;
+	command.arg = idle;
+	return post(command);
+}
+
+void
+Waveshare_ILI9486_RenderTask::sync()
+{
+	if (_task == nullptr)
+	{
+		return;
+	}
+
+	Waveshare_ILI9486_Command command = {};
+	command.op = OpFence;
+	command.fence = ++_fenceIssued;
+
+	//  Fences are never dropped, even in non-blocking mode.
+	while (!_ring.push(command))
+	{
+		vTaskDelay(1);
+	}
+	xTaskNotifyGive(_task);
+
+	while ((int32_t)(_fenceDone.load(std::memory_order_acquire) - command.fence) < 0)
+	{
+		vTaskDelay(1);
+	}
+}
+
+void
+Waveshare_ILI9486_RenderTask::taskEntry(void *pThis)
+{
+	static_cast<Waveshare_ILI9486_RenderTask *>(pThis)->run();
+}
+
+void
+Waveshare_ILI9486_RenderTask::run()
+{
+	bool busOpen = false;
+
+	for (;;)
+	{
+		Waveshare_ILI9486_Command command;
+		if (!_ring.pop(command))
+		{
+			//  Ran dry - let go of the bus so touch and SD can use it, then sleep until
+			//  the producer posts something.
+			if (busOpen)
+			{
+				Waveshare_ILI9486_Impl::endWrite();
+				busOpen = false;
+			}
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			continue;
+		}
+
+		switch (command.op)
+		{
+		case OpFillRect:
+		case OpColors:
+			//  Consecutive draw commands share one transaction.
+			if (!busOpen)
+			{
+				Waveshare_ILI9486_Impl::startWrite();
+				busOpen = true;
+			}
+			if (command.op == OpFillRect)
+			{
+				Waveshare_ILI9486_Impl::writeFillRect2(command.x, command.y, command.w, command.h, command.color);
+			}
+			else
+			{
+				Waveshare_ILI9486_Impl::writeColorsRegion(command.x, command.y, command.w, command.h,
+					command.pColors, command.stride);
+			}
+			break;
+
+		default:
+			//  The rest open their own transaction.
+			if (busOpen)
+			{
+				Waveshare_ILI9486_Impl::endWrite();
+				busOpen = false;
+			}
+
+			switch (command.op)
+			{
+			case OpRotation:
+				Waveshare_ILI9486_Impl::setRotation(command.arg);
+				break;
+
+			case OpInvert:
+				Waveshare_ILI9486_Impl::invertDisplay(command.arg);
+				break;
+
+			case OpIdle:
+				Waveshare_ILI9486_Impl::setIdleMode(command.arg);
+				break;
+
+			case OpFence:
+				_fenceDone.store(command.fence, std::memory_order_release);
+				break;
+			}
+			break;
+		}
+	}
+}
+
+#endif
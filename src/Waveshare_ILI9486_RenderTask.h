@@ -0,0 +1,108 @@
+//  Waveshare ILI9486 render task
+//  - Runs all LCD bus traffic on its own FreeRTOS task, pinned to a core (ESP32 only).
+//
+//  The application pushes small draw commands into a lock-free ring, and a render task
+//  on the other core drains them through the Waveshare_ILI9486_Impl functions.  The
+//  application core is then free for networking while the display is being updated.
+//
+//  Once the render task is running, ALL drawing must go through it.  Drawing directly
+//  with the Waveshare_ILI9486 object at the same time will scramble the screen.  Touch
+//  screen and SD card access are fine - on ESP32 SPI transactions lock the bus, and the
+//  render task releases it whenever the ring runs dry.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_RENDERTASK_h
+#define _WAVESHARE_ILI9486_RENDERTASK_h
+
+#ifdef ARDUINO_ARCH_ESP32
+
+#include "Waveshare_ILI9486_CommandRing.h"
+
+//  One queued draw operation.  Kept small, it gets copied through the ring.
+struct Waveshare_ILI9486_Command
+{
+	uint8_t op;
+	uint8_t arg;
+	int16_t x, y, w, h;
+	uint16_t color;
+	int16_t stride;         //  Of 'pColors', in pixels.
+	const uint16_t *pColors;
+	uint32_t fence;
+};
+
+class Waveshare_ILI9486_RenderTask
+{
+public:
+	static constexpr uint16_t RING_SIZE = 64;
+
+	Waveshare_ILI9486_RenderTask();
+
+	//  Starts the render task.  Call after the display's 'begin()'.  The default core is
+	//  0, leaving core 1 (where 'loop()' runs) to the application.
+	bool begin(uint8_t core = 0, UBaseType_t priority = 2, uint32_t stackSize = 2048);
+
+	//  By default a full ring blocks the caller until the render task catches up.  With
+	//  blocking off, the draw calls below return FALSE instead and the command is
+	//  dropped.
+	void setBlocking(bool blocking) { _blocking = blocking; }
+
+	//  Producer side - call from a single task only.  Co-ordinates are clipped here,
+	//  against the rotation last set through this object.  Everything returns FALSE
+	//  until 'begin()' has succeeded.
+	bool fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	bool fillScreen(uint16_t color);
+	//  'pColors' is not copied!  It must stay unchanged until 'sync()' returns.  Blits
+	//  are clipped like the display's 'drawColors()'.
+	bool drawColors(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *pColors);
+	bool setRotation(uint8_t r);
+	bool invertDisplay(bool i);
+	bool setIdleMode(bool idle);
+
+	//  Fence.  Blocks until every command pushed before it has reached the panel.
+	void sync();
+
+	int16_t width() const { return (_rotation & 1) ? LCD_HEIGHT : LCD_WIDTH; }
+	int16_t height() const { return (_rotation & 1) ? LCD_WIDTH : LCD_HEIGHT; }
+
+private:
+	static constexpr int16_t LCD_WIDTH = 320;
+	static constexpr int16_t LCD_HEIGHT = 480;
+
+	bool post(const Waveshare_ILI9486_Command &command);
+	static void taskEntry(void *pThis);
+	void run();
+
+	Waveshare_ILI9486_CommandRing<Waveshare_ILI9486_Command, RING_SIZE> _ring;
+	TaskHandle_t _task;
+	bool _blocking;
+	uint8_t _rotation;
+
+	//  Producer's last issued fence, and the consumer's last completed one.
+	uint32_t _fenceIssued;
+	std::atomic<uint32_t> _fenceDone;
+};
+
+#endif
+
+#endif
@@ -0,0 +1,403 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <Arduino.h>
+
+#include "Waveshare_ILI9486_Shadow.h"
+
+
+namespace
+{
+	//  MADCTL bits that change the address mapping.
+	constexpr uint8_t MADCTL_MY = 0x80;
+	constexpr uint8_t MADCTL_MX = 0x40;
+	constexpr uint8_t MADCTL_MV = 0x20;
+
+	//  Rows start with room for this many runs, and grow by the same.
+	constexpr uint16_t RUN_GROWTH = 4;
+}
+
+
+Waveshare_ILI9486_Shadow::Waveshare_ILI9486_Shadow()
+	:_pRows(nullptr), _valid(false), _madctl(0x08),
+	_colStart(0), _colEnd(LCD_WIDTH - 1), _pageStart(0), _pageEnd(LCD_HEIGHT - 1),
+	_col(0), _page(0)
+{
+}
+
+Waveshare_ILI9486_Shadow::~Waveshare_ILI9486_Shadow()
+{
+	release();
+}
+
+void
+Waveshare_ILI9486_Shadow::release()
+{
+	if (_pRows != nullptr)
+	{
+		for (int16_t y = 0; y < LCD_HEIGHT; y++)
+		{
+			free(_pRows[y].pRuns);
+		}
+		free(_pRows);
+		_pRows = nullptr;
+	}
+	_valid = false;
+}
+
+bool
+Waveshare_ILI9486_Shadow::begin(uint16_t color)
+{
+	if (_pRows == nullptr)
+	{
+		_pRows = (Row *)calloc(LCD_HEIGHT, sizeof(Row));
+		if (_pRows == nullptr)
+		{
+			return false;
+		}
+	}
+
+	reset(color);
+	return _valid;
+}
+
+void
+Waveshare_ILI9486_Shadow::reset(uint16_t color)
+{
+	if (_pRows == nullptr) return;
+
+	_valid = true;
+	for (int16_t y = 0; y < LCD_HEIGHT; y++)
+	{
+		Row &row = _pRows[y];
+		if (!reserve(row, 1))
+		{
+			return;
+		}
+		row.count = 1;
+		row.pRuns[0].color = color;
+		row.pRuns[0].length = LCD_WIDTH;
+	}
+}
+
+uint32_t
+Waveshare_ILI9486_Shadow::memoryUsed() const
+{
+	if (_pRows == nullptr) return 0;
+
+	uint32_t bytes = LCD_HEIGHT * sizeof(Row);
+	for (int16_t y = 0; y < LCD_HEIGHT; y++)
+	{
+		bytes += _pRows[y].capacity * sizeof(Run);
+	}
+	return bytes;
+}
+
+bool
+Waveshare_ILI9486_Shadow::reserve(Row &row, uint16_t count)
+{
+	if (count <= row.capacity)
+	{
+		return true;
+	}
+
+	uint16_t capacity = count + RUN_GROWTH;
+	Run *pRuns = (Run *)realloc(row.pRuns, capacity * sizeof(Run));
+	if (pRuns == nullptr)
+	{
+		_valid = false;
+		return false;
+	}
+	row.pRuns = pRuns;
+	row.capacity = capacity;
+	return true;
+}
+
+uint16_t
+Waveshare_ILI9486_Shadow::readPixel(int16_t x, int16_t y) const
+{
+	if (!_valid) return 0;
+	if ((x < 0) || (y < 0) || (x >= LCD_WIDTH) || (y >= LCD_HEIGHT)) return 0;
+
+	const Row &row = _pRows[y];
+	int16_t start = 0;
+	for (uint16_t i = 0; i < row.count; i++)
+	{
+		start += row.pRuns[i].length;
+		if (x < start)
+		{
+			return row.pRuns[i].color;
+		}
+	}
+	return 0;
+}
+
+void
+Waveshare_ILI9486_Shadow::fillSpan(int16_t y, int16_t x, int16_t length, uint16_t color)
+{
+	if (!_valid) return;
+
+	Row &row = _pRows[y];
+	Run *pRuns = row.pRuns;
+
+	//  First run touched, and where it starts.
+	uint16_t first = 0;
+	int16_t firstStart = 0;
+	while (firstStart + (int16_t)pRuns[first].length <= x)
+	{
+		firstStart += pRuns[first].length;
+		first++;
+	}
+
+	//  Last run touched, and where it ends.
+	const int16_t end = x + length;
+	uint16_t last = first;
+	int16_t lastEnd = firstStart + pRuns[first].length;
+	while (lastEnd < end)
+	{
+		last++;
+		lastEnd += pRuns[last].length;
+	}
+
+	//  Up to three runs replace first..last - what's left of the first run, the new
+	//  span, and what's left of the last run.
+	Run replacement[3];
+	uint8_t count = 0;
+	if (x > firstStart)
+	{
+		replacement[count].color = pRuns[first].color;
+		replacement[count].length = x - firstStart;
+		count++;
+	}
+	if ((count > 0) && (replacement[count - 1].color == color))
+	{
+		replacement[count - 1].length += length;
+	}
+	else
+	{
+		replacement[count].color = color;
+		replacement[count].length = length;
+		count++;
+	}
+	if (lastEnd > end)
+	{
+		if (pRuns[last].color == color)
+		{
+			replacement[count - 1].length += lastEnd - end;
+		}
+		else
+		{
+			replacement[count].color = pRuns[last].color;
+			replacement[count].length = lastEnd - end;
+			count++;
+		}
+	}
+
+	//  Merge with the neighbours if they're the same color.
+	if ((first > 0) && (pRuns[first - 1].color == replacement[0].color))
+	{
+		first--;
+		replacement[0].length += pRuns[first].length;
+	}
+	if ((last + 1 < row.count) && (pRuns[last + 1].color == replacement[count - 1].color))
+	{
+		last++;
+		replacement[count - 1].length += pRuns[last].length;
+	}
+
+	const uint16_t removed = last - first + 1;
+	const uint16_t newCount = row.count - removed + count;
+	if (!reserve(row, newCount))
+	{
+		return;
+	}
+	pRuns = row.pRuns;
+
+	memmove(pRuns + first + count, pRuns + last + 1, (row.count - last - 1) * sizeof(Run));
+	memcpy(pRuns + first, replacement, count * sizeof(Run));
+	row.count = newCount;
+}
+
+void
+Waveshare_ILI9486_Shadow::writeSpan(int16_t y, int16_t x, int16_t length, const uint16_t *pColors, int8_t step)
+{
+	//  Collapse runs of the same color first, they're common in UI images.
+	int16_t i = 0;
+	while (i < length)
+	{
+		const uint16_t color = *pColors;
+		int16_t run = 1;
+		pColors += step;
+		while ((i + run < length) && (*pColors == color))
+		{
+			run++;
+			pColors += step;
+		}
+		fillSpan(y, x + i, run, color);
+		i += run;
+	}
+}
+
+void
+Waveshare_ILI9486_Shadow::setMemoryAccess(uint8_t madctl)
+{
+	_madctl = madctl;
+}
+
+void
+Waveshare_ILI9486_Shadow::setWindow(uint16_t colStart, uint16_t colEnd, uint16_t pageStart, uint16_t pageEnd)
+{
+	_colStart = colStart;
+	_colEnd = colEnd;
+	_pageStart = pageStart;
+	_pageEnd = pageEnd;
+}
+
+void
+Waveshare_ILI9486_Shadow::startPixels()
+{
+	_col = _colStart;
+	_page = _pageStart;
+}
+
+void
+Waveshare_ILI9486_Shadow::addressToPanel(int16_t col, int16_t page, int16_t &x, int16_t &y) const
+{
+	//  Row / column exchange happens first, then the mirroring.
+	const int16_t a = (_madctl & MADCTL_MV) ? page : col;
+	const int16_t b = (_madctl & MADCTL_MV) ? col : page;
+	x = (_madctl & MADCTL_MX) ? LCD_WIDTH - 1 - a : a;
+	y = (_madctl & MADCTL_MY) ? LCD_HEIGHT - 1 - b : b;
+}
+
+void
+Waveshare_ILI9486_Shadow::fillAddressRect(int16_t col0, int16_t col1, int16_t page0, int16_t page1, uint16_t color)
+{
+	int16_t x0, y0, x1, y1;
+	addressToPanel(col0, page0, x0, y0);
+	addressToPanel(col1, page1, x1, y1);
+	if (x0 > x1)
+	{
+		int16_t t = x0; x0 = x1; x1 = t;
+	}
+	if (y0 > y1)
+	{
+		int16_t t = y0; y0 = y1; y1 = t;
+	}
+
+	if (x0 < 0) x0 = 0;
+	if (y0 < 0) y0 = 0;
+	if (x1 >= LCD_WIDTH) x1 = LCD_WIDTH - 1;
+	if (y1 >= LCD_HEIGHT) y1 = LCD_HEIGHT - 1;
+
+	for (int16_t y = y0; y <= y1; y++)
+	{
+		fillSpan(y, x0, x1 - x0 + 1, color);
+	}
+}
+
+void
+Waveshare_ILI9486_Shadow::advance(uint32_t count)
+{
+	const int16_t rowLength = _colEnd - _colStart + 1;
+	const int16_t pages = _pageEnd - _pageStart + 1;
+
+	uint32_t pixels = (uint32_t)(_col - _colStart) + count;
+	_col = _colStart + pixels % rowLength;
+	_page = _pageStart + ((uint32_t)(_page - _pageStart) + pixels / rowLength) % pages;
+}
+
+void
+Waveshare_ILI9486_Shadow::writeRepeat(uint16_t color, uint32_t count)
+{
+	const int16_t rowLength = _colEnd - _colStart + 1;
+	if (rowLength <= 0) return;
+
+	while ((count > 0) && _valid)
+	{
+		if ((_col == _colStart) && (count >= (uint32_t)rowLength))
+		{
+			//  Whole rows of the window, as one rectangle.
+			uint32_t rows = count / rowLength;
+			if (rows > (uint32_t)(_pageEnd - _page + 1)) rows = _pageEnd - _page + 1;
+
+			fillAddressRect(_colStart, _colEnd, _page, _page + rows - 1, color);
+			count -= rows * rowLength;
+			advance(rows * rowLength);
+			continue;
+		}
+
+		//  Partial row.
+		uint32_t n = _colEnd - _col + 1;
+		if (n > count) n = count;
+		fillAddressRect(_col, _col + n - 1, _page, _page, color);
+		count -= n;
+		advance(n);
+	}
+}
+
+void
+Waveshare_ILI9486_Shadow::writePixels(const uint16_t *pColors, uint32_t count)
+{
+	while ((count > 0) && _valid)
+	{
+		int16_t n = _colEnd - _col + 1;
+		if ((uint32_t)n > count) n = count;
+
+		if (!(_madctl & MADCTL_MV))
+		{
+			//  Address rows are panel rows, possibly mirrored.
+			int16_t x0, x1, y;
+			addressToPanel(_col, _page, x0, y);
+			addressToPanel(_col + n - 1, _page, x1, y);
+			if ((y >= 0) && (y < LCD_HEIGHT) && (x0 >= 0) && (x1 >= 0) &&
+				(x0 < LCD_WIDTH) && (x1 < LCD_WIDTH))
+			{
+				if (x0 <= x1)
+				{
+					writeSpan(y, x0, n, pColors, 1);
+				}
+				else
+				{
+					writeSpan(y, x1, n, pColors + n - 1, -1);
+				}
+			}
+		}
+		else
+		{
+			//  Address rows are panel columns, one pixel per panel row.
+			for (int16_t i = 0; i < n; i++)
+			{
+				int16_t x, y;
+				addressToPanel(_col + i, _page, x, y);
+				if ((x >= 0) && (y >= 0) && (x < LCD_WIDTH) && (y < LCD_HEIGHT))
+				{
+					fillSpan(y, x, 1, pColors[i]);
+				}
+			}
+		}
+
+		pColors += n;
+		count -= n;
+		advance(n);
+	}
+}
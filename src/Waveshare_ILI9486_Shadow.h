@@ -0,0 +1,111 @@
+//  Waveshare ILI9486 shadow
+//  - Run length encoded copy of the panel contents, so pixels can be read back.
+//
+//  The shield can't read GRAM.  Attach one of these to the display and every write path
+//  keeps it up to date, which makes 'readPixel()', 'copyRect()', 'moveRect()' and
+//  'saveRect()' possible.  Each row is stored as a list of (color, length) runs, so
+//  memory grows with how busy the screen is, not with its size.  A flat UI is a few KB,
+//  instead of the 307 KB a full framebuffer would need.
+//
+//  It works by emulating the panel's own address generator - window, write pointer and
+//  memory access control (MADCTL) - in panel (rotation 0) co-ordinates.  Solid fills
+//  cost a span update per row.  Blits in rotation 1 or 3 run down panel columns, and
+//  are tracked a pixel at a time, so are noticeably slower to shadow.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_SHADOW_h
+#define _WAVESHARE_ILI9486_SHADOW_h
+
+class Waveshare_ILI9486_Shadow
+{
+public:
+	Waveshare_ILI9486_Shadow();
+	~Waveshare_ILI9486_Shadow();
+
+	//  Allocates the row table, with the whole screen set to 'color'.  That has to match
+	//  what's really on the panel - after 'begin()' it's black, unless the clear was
+	//  skipped.  Returns FALSE if there isn't enough memory.
+	bool begin(uint16_t color = 0x0000);
+
+	//  Forget everything, the whole screen is now 'color'.
+	void reset(uint16_t color);
+
+	//  FALSE if an update ran out of memory.  The contents can't be trusted after that,
+	//  until 'reset()' is called.
+	bool isValid() const { return _valid; }
+
+	//  Bytes currently allocated.
+	uint32_t memoryUsed() const;
+
+	//  Panel co-ordinates (rotation 0).  Off screen pixels read as 0.
+	uint16_t readPixel(int16_t x, int16_t y) const;
+
+	//  Called by Waveshare_ILI9486_Impl as it talks to the panel.
+	void setMemoryAccess(uint8_t madctl);
+	void setWindow(uint16_t colStart, uint16_t colEnd, uint16_t pageStart, uint16_t pageEnd);
+	void startPixels();
+	void writeRepeat(uint16_t color, uint32_t count);
+	void writePixels(const uint16_t *pColors, uint32_t count);
+
+	//  Maps a (column, page) address, as the panel sees it under the current MADCTL,
+	//  to panel co-ordinates.
+	void addressToPanel(int16_t col, int16_t page, int16_t &x, int16_t &y) const;
+
+	static constexpr int16_t LCD_WIDTH = 320;
+	static constexpr int16_t LCD_HEIGHT = 480;
+
+private:
+	struct Run
+	{
+		uint16_t color;
+		uint16_t length;
+	};
+
+	struct Row
+	{
+		Run *pRuns;
+		uint16_t count;
+		uint16_t capacity;
+	};
+
+	void release();
+	bool reserve(Row &row, uint16_t count);
+
+	//  Panel co-ordinates, already clipped.
+	void fillSpan(int16_t y, int16_t x, int16_t length, uint16_t color);
+	//  'step' is +1 or -1, to walk 'pColors' backwards for mirrored writes.
+	void writeSpan(int16_t y, int16_t x, int16_t length, const uint16_t *pColors, int8_t step);
+	//  A rectangle of addresses, all one color.
+	void fillAddressRect(int16_t col0, int16_t col1, int16_t page0, int16_t page1, uint16_t color);
+	void advance(uint32_t count);
+
+	Row *_pRows;
+	bool _valid;
+
+	uint8_t _madctl;
+	int16_t _colStart, _colEnd, _pageStart, _pageEnd;
+	int16_t _col, _page;
+};
+
+#endif
@@ -0,0 +1,235 @@
+//  Waveshare ILI9486 strip chart
+//  - Scrolling-free trend / oscilloscope trace that only touches one column per sample.
+//
+//  The trace wraps around the chart like a ring buffer, instead of scrolling.  For each
+//  sample, the chart remembers the vertical segment it drew in that column last time
+//  round, and only erases the part of the old segment the new one doesn't cover, and
+//  only draws the part of the new one that wasn't already there.  That's at most four
+//  short vertical lines per sample, instead of clearing and redrawing the plot area.
+//
+//  One trace per chart.  For several channels, give each its own chart area.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_STRIPCHART_h
+#define _WAVESHARE_ILI9486_STRIPCHART_h
+
+//  MAX_COLUMNS sets the storage, 4 bytes a column.  The chart width passed to the
+//  constructor is clamped to it.
+template<class Display, uint16_t MAX_COLUMNS = 320>
+class Waveshare_ILI9486_StripChart
+{
+public:
+	Waveshare_ILI9486_StripChart(Display &display, int16_t x, int16_t y, int16_t w, int16_t h,
+		uint16_t color, uint16_t bg);
+
+	//  Sample values that map to the bottom and top rows.  Values outside are clamped.
+	//  Defaults to 0 - 1023, to suit 'analogRead()'.
+	void setRange(int16_t bottom, int16_t top);
+
+	//  Columns ahead of the newest sample that are kept blank, so it's easy to see where
+	//  the trace is being written.  Defaults to 0.
+	void setGap(uint8_t columns);
+
+	//  Fills the chart area with the background, and forgets the old trace.
+	void clear();
+
+	//  Plots one sample in the next column, joined to the previous sample.
+	void addSample(int16_t value);
+
+	int16_t width() const { return _w; }
+	int16_t height() const { return _h; }
+
+private:
+	//  What's drawn in a column.  top > bottom means nothing.
+	struct Segment
+	{
+		int16_t top, bottom;
+	};
+
+	int16_t toRow(int16_t value) const;
+	//  Draws 'to' in the column, touching only the pixels that differ from 'from'.
+	void update(int16_t column, Segment from, Segment to);
+
+	Display &_display;
+	int16_t _x, _y, _w, _h;
+	uint16_t _color, _bg;
+	int16_t _rangeBottom, _rangeTop;
+	uint8_t _gap;
+
+	int16_t _column;      //  Next column to be written.
+	int16_t _lastRow;     //  Row of the previous sample, or -1 for none.
+	Segment _segments[MAX_COLUMNS];
+};
+
+
+////  Template implementation follows
+template<class Display, uint16_t MAX_COLUMNS>
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::Waveshare_ILI9486_StripChart(
+	Display &display, int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+	:_display(display), _x(x), _y(y),
+	_w(w > (int16_t)MAX_COLUMNS ? MAX_COLUMNS : w), _h(h),
+	_color(color), _bg(bg),
+	_rangeBottom(0), _rangeTop(1023), _gap(0),
+	_column(0), _lastRow(-1)
+{
+	for (int16_t i = 0; i < _w; i++)
+	{
+		_segments[i].top = 1;
+		_segments[i].bottom = 0;
+	}
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+void
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::setRange(int16_t bottom, int16_t top)
+{
+	_rangeBottom = bottom;
+	_rangeTop = top;
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+void
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::setGap(uint8_t columns)
+{
+	_gap = columns;
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+void
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::clear()
+{
+	_display.fillRect(_x, _y, _w, _h, _bg);
+	for (int16_t i = 0; i < _w; i++)
+	{
+		_segments[i].top = 1;
+		_segments[i].bottom = 0;
+	}
+	_column = 0;
+	_lastRow = -1;
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+int16_t
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::toRow(int16_t value) const
+{
+	const int32_t span = (int32_t)_rangeTop - _rangeBottom;
+	if (span == 0) return _h - 1;
+
+	//  Row 0 is the top of the chart.
+	int32_t row = (int32_t)(_h - 1) - ((int32_t)value - _rangeBottom) * (_h - 1) / span;
+	if (row < 0) row = 0;
+	if (row > _h - 1) row = _h - 1;
+	return (int16_t)row;
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+void
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::update(int16_t column, Segment from, Segment to)
+{
+	const int16_t x = _x + column;
+	const bool hadOld = from.top <= from.bottom;
+	const bool hasNew = to.top <= to.bottom;
+
+	if (!hasNew)
+	{
+		if (hadOld)
+		{
+			_display.writeFastVLine(x, _y + from.top, from.bottom - from.top + 1, _bg);
+		}
+		return;
+	}
+
+	if (!hadOld)
+	{
+		_display.writeFastVLine(x, _y + to.top, to.bottom - to.top + 1, _color);
+		return;
+	}
+
+	//  Erase old pixels above and below the new segment.
+	if (from.top < to.top)
+	{
+		int16_t end = (from.bottom < to.top - 1) ? from.bottom : to.top - 1;
+		_display.writeFastVLine(x, _y + from.top, end - from.top + 1, _bg);
+	}
+	if (from.bottom > to.bottom)
+	{
+		int16_t start = (from.top > to.bottom + 1) ? from.top : to.bottom + 1;
+		_display.writeFastVLine(x, _y + start, from.bottom - start + 1, _bg);
+	}
+
+	//  Draw new pixels above and below the old segment.
+	if (to.top < from.top)
+	{
+		int16_t end = (to.bottom < from.top - 1) ? to.bottom : from.top - 1;
+		_display.writeFastVLine(x, _y + to.top, end - to.top + 1, _color);
+	}
+	if (to.bottom > from.bottom)
+	{
+		int16_t start = (to.top > from.bottom + 1) ? to.top : from.bottom + 1;
+		_display.writeFastVLine(x, _y + start, to.bottom - start + 1, _color);
+	}
+}
+
+template<class Display, uint16_t MAX_COLUMNS>
+void
+Waveshare_ILI9486_StripChart<Display, MAX_COLUMNS>::addSample(int16_t value)
+{
+	if (_w <= 0) return;
+
+	const int16_t row = toRow(value);
+
+	//  Join to the previous sample - but not across the wrap from right to left.
+	Segment segment;
+	if ((_lastRow < 0) || (_column == 0))
+	{
+		segment.top = segment.bottom = row;
+	}
+	else
+	{
+		segment.top = (row < _lastRow) ? row : _lastRow;
+		segment.bottom = (row > _lastRow) ? row : _lastRow;
+	}
+
+	_display.startWrite();
+	update(_column, _segments[_column], segment);
+	_segments[_column] = segment;
+
+	for (uint8_t i = 1; i <= _gap; i++)
+	{
+		int16_t column = (_column + i) % _w;
+		Segment empty = {1, 0};
+		update(column, _segments[column], empty);
+		_segments[column] = empty;
+	}
+	_display.endWrite();
+
+	_lastRow = row;
+	_column++;
+	if (_column >= _w)
+	{
+		_column = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,105 @@
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <Arduino.h>
+
+#include "Waveshare_ILI9486_TouchTrace.h"
+
+
+Waveshare_ILI9486_TouchTrace::Waveshare_ILI9486_TouchTrace(Sample *pSamples, uint16_t capacity, uint16_t count)
+	:_pSamples(pSamples), _capacity(capacity), _count((count < capacity) ? count : capacity),
+	_mode(STOPPED), _lastMicros(0), _position(0), _skipped(0), _time(0)
+{
+}
+
+void
+Waveshare_ILI9486_TouchTrace::startRecording()
+{
+	_count = 0;
+	_lastMicros = micros();
+	_mode = RECORDING;
+}
+
+void
+Waveshare_ILI9486_TouchTrace::startReplay()
+{
+	_position = 0;
+	_skipped = 0;
+	_time = 0;
+	_mode = REPLAYING;
+}
+
+void
+Waveshare_ILI9486_TouchTrace::stop()
+{
+	_mode = STOPPED;
+}
+
+void
+Waveshare_ILI9486_TouchTrace::record(uint8_t channel, uint16_t value)
+{
+	if ((_mode != RECORDING) || (_count == _capacity)) return;
+
+	const uint32_t now = micros();
+	const uint32_t dt = now - _lastMicros;
+	_lastMicros = now;
+
+	Sample &s = _pSamples[_count++];
+	s.dt = (dt < 0xFFFF) ? dt : 0xFFFF;
+	s.code = ((uint16_t)((channel >> 4) & 0x07) << 13) | (value & 0x1FFF);
+}
+
+uint16_t
+Waveshare_ILI9486_TouchTrace::replay(uint8_t channel)
+{
+	const uint8_t address = (channel >> 4) & 0x07;
+	while (_position < _count)
+	{
+		const Sample &s = _pSamples[_position++];
+		_time += s.dt;
+		if ((s.code >> 13) == address)
+		{
+			return value(s);
+		}
+		_skipped++;
+	}
+	return 0;
+}
+
+void
+Waveshare_ILI9486_TouchTrace::printTo(Print &out) const
+{
+	out.print(F("// "));
+	out.print(_count);
+	out.println(F(" samples"));
+	out.println(F("Waveshare_ILI9486_TouchTrace::Sample trace[] = {"));
+	for (uint16_t i = 0; i < _count; i++)
+	{
+		out.print(((i & 7) == 0) ? F("\t{") : F(" {"));
+		out.print(_pSamples[i].dt);
+		out.print(F(", 0x"));
+		out.print(_pSamples[i].code, HEX);
+		out.print(F("},"));
+		if (((i & 7) == 7) || (i + 1 == _count)) out.println();
+	}
+	out.println(F("};"));
+}
@@ -0,0 +1,113 @@
+//  Waveshare ILI9486 touch trace
+//  - Records raw touch controller readings, and plays them back in place of the
+//    hardware.
+//
+//  Tuning the touch pipeline - NUMSAMPLES, 'slop', calibration - normally needs someone
+//  with a stylus, and no two runs see the same input.  Attach one of these with
+//  'attachTouchTrace()' and 'startRecording()', and every controller reading is stored
+//  with the time since the one before.  Later, 'startReplay()' feeds exactly the same
+//  readings back through 'getPoint()' and 'normalizeTsPoint()', without the stylus, the
+//  controller, or the SPI bus.  Each variant of the pipeline can be run over the same
+//  trace and compared - see the TouchTrace example, and test/touch_replay.cpp.
+//
+//  Each sample is 4 bytes, so a few seconds of drawing fits in a few KB.  'printTo()'
+//  writes the trace as C source, to paste into a sketch or replay in the host build.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_TOUCHTRACE_h
+#define _WAVESHARE_ILI9486_TOUCHTRACE_h
+
+class Print;
+
+class Waveshare_ILI9486_TouchTrace
+{
+public:
+	//  One controller reading.  'code' is the channel's address bits (the 0x70 bits of
+	//  the command byte) in the top 3 bits, and the 13 bit reading below them.
+	struct Sample
+	{
+		uint16_t dt;                //  Microseconds since the last reading, at most 65535.
+		uint16_t code;
+	};
+
+	//  'pSamples' is owned by the caller.  For a trace made earlier, pass how many
+	//  samples are already in it as 'count'.
+	Waveshare_ILI9486_TouchTrace(Sample *pSamples, uint16_t capacity, uint16_t count = 0);
+
+	//  Starts a new trace.  Readings still come from the controller.
+	void startRecording();
+	//  Replays from the start.  Readings come from the trace, and the controller isn't
+	//  touched.
+	void startReplay();
+	//  Back to the controller, keeping the trace.
+	void stop();
+
+	bool isRecording() const { return _mode == RECORDING; }
+	bool isReplaying() const { return _mode == REPLAYING; }
+
+	//  Recording stops when the buffer fills.
+	uint16_t count() const { return _count; }
+	bool isFull() const { return _count == _capacity; }
+	const Sample *samples() const { return _pSamples; }
+
+	//  Replay progress.  'time()' is the trace's own clock - the recorded time of the
+	//  last sample handed out, in microseconds.  If the pipeline asks for a channel the
+	//  trace doesn't have next (say NUMSAMPLES was changed), samples are skipped until it
+	//  does, and counted in 'skipped()'.  Once the end is reached 'isFinished()' is TRUE
+	//  and every reading is 0.
+	uint16_t position() const { return _position; }
+	uint32_t time() const { return _time; }
+	uint16_t skipped() const { return _skipped; }
+	bool isFinished() const { return _position >= _count; }
+
+	static uint8_t channel(const Sample &s) { return 0x80 | ((s.code >> 13) << 4); }
+	static uint16_t value(const Sample &s) { return s.code & 0x1FFF; }
+
+	//  Writes the trace as a C array, 8 samples a line.
+	void printTo(Print &out) const;
+
+	//  Called by the touch code for every controller reading.
+	void record(uint8_t channel, uint16_t value);
+	uint16_t replay(uint8_t channel);
+
+private:
+	enum Mode : uint8_t
+	{
+		STOPPED,
+		RECORDING,
+		REPLAYING
+	};
+
+	Sample *_pSamples;
+	uint16_t _capacity;
+	uint16_t _count;
+	Mode _mode;
+
+	uint32_t _lastMicros;
+	uint16_t _position;
+	uint16_t _skipped;
+	uint32_t _time;
+};
+
+#endif
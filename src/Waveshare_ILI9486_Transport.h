@@ -0,0 +1,363 @@
+//  Waveshare ILI9486 transport
+//  - How bytes get to the panel, one policy per platform, picked at compile time.
+//
+//  Internal to Waveshare_ILI9486.cpp, don't include it anywhere else.  Every transport
+//  has the same static members:
+//
+//    writeCommand16(frame)             One 16 bit frame - a command or parameter.
+//    writeBytes(pBytes, count)         Bytes as they are, in order.
+//    writeRepeat(color, count)         One pixel 'count' times.
+//    writePattern(pBytes, size, n)     'size' bytes (at most 64) 'n' times over.
+//    writeBuffer(pColors, count)       Pixels in native byte order.
+//    writeBufferAsync(pColors, count)  The same, but can return before it's done.
+//                                      'pColors' has to stay put until 'flush()'.
+//    flush()                           Waits for anything still going out.
+//
+//  None of the Arduino SPI libraries queue transfers, so for now 'writeBufferAsync()'
+//  finishes before it returns, and 'flush()' has nothing to do.  The driver still calls
+//  them where it could overlap work, and flushes before every DC or CS change.
+//
+//  Define WAVESHARE_ILI9486_HOST to build with HostTransport, which sends nothing and
+//  counts the bytes, so drawing code can be timed off target.
+//
+// The MIT License
+//
+// Copyright 2019-2020 M Hotchin
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef _WAVESHARE_ILI9486_TRANSPORT_h
+#define _WAVESHARE_ILI9486_TRANSPORT_h
+
+namespace Waveshare_ILI9486_Transport
+{
+	//  Anything with an Arduino SPI library.  'transfer16()' is the widest call they all
+	//  have.
+	struct GenericTransport
+	{
+		static void writeCommand16(uint16_t frame)
+		{
+			SPI.transfer16(frame);
+		}
+
+		static void writeBytes(const uint8_t *pBytes, size_t count)
+		{
+			while (count--)
+			{
+				SPI.transfer(*pBytes++);
+			}
+		}
+
+		static void writeRepeat(uint16_t color, unsigned long count)
+		{
+			for (unsigned long i = 0; i < count; i++)
+			{
+				SPI.transfer16(color);
+			}
+		}
+
+		static void writePattern(const uint8_t *pBytes, uint8_t size, unsigned long repeat)
+		{
+			while (repeat--)
+			{
+				writeBytes(pBytes, size);
+			}
+		}
+
+		static void writeBuffer(const uint16_t *pColors, unsigned long count)
+		{
+			while (count--)
+			{
+				SPI.transfer16(*pColors++);
+			}
+		}
+
+		static void writeBufferAsync(const uint16_t *pColors, unsigned long count)
+		{
+			writeBuffer(pColors, count);
+		}
+
+		static void flush()
+		{
+		}
+	};
+
+#if defined ARDUINO_ARCH_AVR
+	inline void transfer16Repeat(uint16_t data, unsigned long count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		//  Fast way to split a 16bit into into 2 8 bit ints.
+		union
+		{
+			uint16_t val;
+			struct
+			{
+				uint8_t lsb; uint8_t msb;
+			};
+		} in;
+		in.val = data;
+
+		//  Slightly faster using these, I think the optimizer can take advantage that
+		//  there is no aliasing?
+		const uint8_t msb = in.msb;
+		const uint8_t lsb = in.lsb;
+
+		//  Loop phase shifting AND Duff's device?  Inconceivable!
+		SPDR = msb;
+		count--;
+		while (!(SPSR & _BV(SPIF)));
+		SPDR = lsb;
+		switch (count & 0x01)
+		{
+		case 0:
+			while (count)
+			{
+				count--;
+				while (!(SPSR & _BV(SPIF)));
+				SPDR = msb;
+				asm volatile("nop");
+				while (!(SPSR & _BV(SPIF)));
+				SPDR = lsb;
+		case 1:
+			count--;
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = msb;
+			asm volatile("nop");
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = lsb;
+			}
+		}
+		// MUST wait for final shift out to complete!  Otherwise subsequent commands
+		// happen quickly enough to stomp on it.
+		asm volatile("nop");
+		while (!(SPSR & _BV(SPIF)));
+
+	}
+
+	//  Streams pixels straight out of flash.  Each pixel is fetched while the previous
+	//  one's high byte is still shifting out, so the SPI never waits on LPM.
+	inline void transfer16Progmem(const uint16_t *pData, unsigned long count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		uint16_t color = pgm_read_word(pData++);
+		SPDR = color >> 8;
+		while (--count)
+		{
+			const uint8_t lsb = color & 0xff;
+			color = pgm_read_word(pData++);
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = lsb;
+			const uint8_t msb = color >> 8;
+			asm volatile("nop");
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = msb;
+		}
+		while (!(SPSR & _BV(SPIF)));
+		SPDR = color & 0xff;
+
+		// MUST wait for final shift out to complete!
+		asm volatile("nop");
+		while (!(SPSR & _BV(SPIF)));
+	}
+
+	//  Same again for 8 bit grayscale, expanded to RGB565 on the fly.
+	inline void transferGrayProgmem(const uint8_t *pData, unsigned long count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		uint8_t gray = pgm_read_byte(pData++);
+		SPDR = (gray & 0xF8) | (gray >> 5);
+		while (--count)
+		{
+			const uint8_t lsb = ((gray & 0x1C) << 3) | (gray >> 3);
+			gray = pgm_read_byte(pData++);
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = lsb;
+			const uint8_t msb = (gray & 0xF8) | (gray >> 5);
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = msb;
+		}
+		while (!(SPSR & _BV(SPIF)));
+		SPDR = ((gray & 0x1C) << 3) | (gray >> 3);
+
+		asm volatile("nop");
+		while (!(SPSR & _BV(SPIF)));
+	}
+
+	//  Version of SPI.transfer(...) that *doesn't* read data back into the buffer.
+	inline void transferOut(const uint8_t *p, size_t count)
+	{
+		if (count == 0) return;
+		SPDR = *p++;
+		while (--count > 0)
+		{
+			uint8_t out = *p++;
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = out;
+		}
+		while (!(SPSR & _BV(SPIF)));
+	}
+
+	//  Talks to the SPI data register directly.  Can also stream straight out of flash.
+	struct AvrTransport : GenericTransport
+	{
+		static void writeCommand16(uint16_t frame)
+		{
+			const uint8_t bytes[2] = { (uint8_t)(frame >> 8), (uint8_t)(frame & 0xff) };
+			transferOut(bytes, 2);
+		}
+
+		static void writeBytes(const uint8_t *pBytes, size_t count)
+		{
+			transferOut(pBytes, count);
+		}
+
+		static void writeRepeat(uint16_t color, unsigned long count)
+		{
+			transfer16Repeat(color, count);
+		}
+
+		static void writePattern(const uint8_t *pBytes, uint8_t size, unsigned long repeat)
+		{
+			while (repeat--)
+			{
+				transferOut(pBytes, size);
+			}
+		}
+
+		static void writeProgmem(const uint16_t *pColors, unsigned long count)
+		{
+			transfer16Progmem(pColors, count);
+		}
+
+		static void writeGrayProgmem(const uint8_t *pGrays, unsigned long count)
+		{
+			transferGrayProgmem(pGrays, count);
+		}
+	};
+#endif
+
+#if defined ARDUINO_ARCH_ESP32 || defined ARDUINO_ARCH_ESP8266
+	//  Both have a 64 byte FIFO, and 'write...()' calls that fill it without reading
+	//  anything back.
+	struct EspTransport
+	{
+		static void writeCommand16(uint16_t frame)
+		{
+			SPI.write16(frame);
+		}
+
+		static void writeBytes(const uint8_t *pBytes, size_t count)
+		{
+			SPI.writeBytes((uint8_t *)pBytes, count);
+		}
+
+		static void writeRepeat(uint16_t color, unsigned long count)
+		{
+			uint8_t pattern[2];
+			pattern[0] = color >> 8;
+			pattern[1] = color & 0xff;
+
+			SPI.writePattern(pattern, 2, count);
+		}
+
+		static void writePattern(const uint8_t *pBytes, uint8_t size, unsigned long repeat)
+		{
+			SPI.writePattern((uint8_t *)pBytes, size, repeat);
+		}
+
+#if defined ARDUINO_ARCH_ESP32
+		//  'writePixels()' swaps to big endian as it fills the FIFO.
+		static void writeBuffer(const uint16_t *pColors, unsigned long count)
+		{
+			SPI.writePixels((const uint8_t *)pColors, count * 2);
+		}
+#else
+		//  No 'writePixels()', and 'writeBytes()' sends memory order.  Swap to big endian
+		//  a FIFO full at a time.
+		static void writeBuffer(const uint16_t *pColors, unsigned long count)
+		{
+			constexpr uint8_t CHUNK = 32;
+			uint8_t chunk[2 * CHUNK];
+			while (count > 0)
+			{
+				const uint8_t n = (count < CHUNK) ? count : CHUNK;
+				for (uint8_t i = 0; i < n; i++)
+				{
+					chunk[2 * i] = pColors[i] >> 8;
+					chunk[2 * i + 1] = pColors[i] & 0xff;
+				}
+				SPI.writeBytes(chunk, 2 * n);
+				pColors += n;
+				count -= n;
+			}
+		}
+#endif
+
+		static void writeBufferAsync(const uint16_t *pColors, unsigned long count)
+		{
+			writeBuffer(pColors, count);
+		}
+
+		static void flush()
+		{
+		}
+	};
+#endif
+
+#if defined WAVESHARE_ILI9486_HOST
+	//  Sends nothing, just counts.
+	struct HostTransport
+	{
+		static uint32_t bytesWritten;
+
+		static void writeCommand16(uint16_t) { bytesWritten += 2; }
+		static void writeBytes(const uint8_t *, size_t count) { bytesWritten += count; }
+		static void writeRepeat(uint16_t, unsigned long count) { bytesWritten += 2 * count; }
+		static void writePattern(const uint8_t *, uint8_t size, unsigned long repeat)
+		{
+			bytesWritten += (uint32_t)size * repeat;
+		}
+		static void writeBuffer(const uint16_t *, unsigned long count) { bytesWritten += 2 * count; }
+		static void writeBufferAsync(const uint16_t *, unsigned long count) { bytesWritten += 2 * count; }
+		static void flush() {}
+	};
+
+	typedef HostTransport Transport;
+#elif defined ARDUINO_ARCH_AVR
+	typedef AvrTransport Transport;
+#elif defined ARDUINO_ARCH_ESP32 || defined ARDUINO_ARCH_ESP8266
+	typedef EspTransport Transport;
+#else
+	typedef GenericTransport Transport;
+#endif
+}
+
+#endif
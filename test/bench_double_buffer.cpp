@@ -0,0 +1,286 @@
+//  DoubleBuffer's 'present()' on the host - the time its row diff (firstDifference /
+//  firstMatch) takes, and the bytes it sends, for a few kinds of change.  Then a sweep
+//  of the span merge gap, to show where SPAN_MERGE_GAP comes from.
+//
+//  Bytes are counted by HostTransport, so they include the address window caching.  The
+//  time doesn't include the panel, only the diff and the (empty) transport calls.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <string.h>
+#include <vector>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_Benchmark.h>
+#include <Waveshare_ILI9486_DoubleBuffer.h>
+
+namespace
+{
+	constexpr int16_t WIDTH = 320;
+	constexpr int16_t HEIGHT = 480;
+	constexpr uint32_t PIXELS = (uint32_t)WIDTH * HEIGHT;
+
+	typedef std::vector<uint16_t> Frame;
+
+	//  Frame 'before' with some pixels changed.
+	struct Change
+	{
+		const char *pName;
+		Frame after;
+	};
+
+	//  Something busy to start from, so changes aren't all against a flat color.
+	Frame background()
+	{
+		Frame frame(PIXELS);
+		for (uint32_t i = 0; i < PIXELS; i++)
+		{
+			frame[i] = (uint16_t)(i * 2654435761u >> 16);
+		}
+		return frame;
+	}
+
+	uint32_t random32(uint32_t &state)
+	{
+		state = state * 1664525 + 1013904223;
+		return state >> 8;
+	}
+
+	std::vector<Change> changes(const Frame &before)
+	{
+		std::vector<Change> list;
+		Change change;
+
+		change.pName = "none";
+		change.after = before;
+		list.push_back(change);
+
+		change.pName = "one_pixel";
+		change.after = before;
+		change.after[240 * WIDTH + 160] ^= 0xFFFF;
+		list.push_back(change);
+
+		//  A readout - 8 digits of 12x16 where about half of each glyph's pixels change.
+		change.pName = "digits";
+		change.after = before;
+		for (int16_t digit = 0; digit < 8; digit++)
+		{
+			for (int16_t y = 0; y < 16; y++)
+			{
+				for (int16_t x = 0; x < 12; x++)
+				{
+					if (((x * 3 + y * 5 + digit) % 7) < 4)
+					{
+						change.after[(100 + y) * WIDTH + 40 + digit * 14 + x] ^= 0xFFFF;
+					}
+				}
+			}
+		}
+		list.push_back(change);
+
+		//  Single pixels every N columns, on every row - the merge decision each time.
+		static const char *const strideNames[] = { "every_4th", "every_8th", "every_16th" };
+		for (uint8_t n = 0; n < 3; n++)
+		{
+			const int16_t stride = 4 << n;
+			change.pName = strideNames[n];
+			change.after = before;
+			for (int16_t y = 0; y < HEIGHT; y++)
+			{
+				for (int16_t x = 0; x < WIDTH; x += stride)
+				{
+					change.after[y * WIDTH + x] ^= 0xFFFF;
+				}
+			}
+			list.push_back(change);
+		}
+
+		change.pName = "noise_10pct";
+		change.after = before;
+		uint32_t state = 1;
+		for (uint32_t i = 0; i < PIXELS / 10; i++)
+		{
+			change.after[random32(state) % PIXELS] ^= 0xFFFF;
+		}
+		list.push_back(change);
+
+		change.pName = "everything";
+		change.after = before;
+		for (uint32_t i = 0; i < PIXELS; i++)
+		{
+			change.after[i] ^= 0xFFFF;
+		}
+		list.push_back(change);
+
+		return list;
+	}
+
+	Waveshare_ILI9486 tft;
+
+	//  Setting the rotation makes the display forget its cached address window, so each
+	//  count starts from the same state.
+	void forgetWindow()
+	{
+		tft.setRotation(0);
+	}
+
+	//  'present()'s span building, with the merge gap as a parameter, sending through
+	//  the same transport.  Returns the bytes sent.
+	uint32_t presentWithGap(const Frame &before, Frame &after, int16_t gap)
+	{
+		forgetWindow();
+		const uint32_t start = Waveshare_ILI9486_Impl::hostBytesWritten();
+
+		Waveshare_ILI9486_Impl::startWrite();
+		for (int16_t row = 0; row < HEIGHT; row++)
+		{
+			const uint16_t *pFront = before.data() + (int32_t)row * WIDTH;
+			uint16_t *pBack = after.data() + (int32_t)row * WIDTH;
+
+			int16_t col = 0;
+			while ((col < WIDTH) && (pFront[col] == pBack[col])) col++;
+			while (col < WIDTH)
+			{
+				const int16_t spanStart = col;
+				int16_t end;
+				for (;;)
+				{
+					end = col;
+					while ((end < WIDTH) && (pFront[end] != pBack[end])) end++;
+					col = end;
+					while ((col < WIDTH) && (pFront[col] == pBack[col])) col++;
+					if ((col >= WIDTH) || (col - end > gap)) break;
+				}
+				Waveshare_ILI9486_Impl::writeColors(spanStart, row, end - spanStart, 1, pBack + spanStart);
+			}
+		}
+		Waveshare_ILI9486_Impl::endWrite();
+
+		return Waveshare_ILI9486_Impl::hostBytesWritten() - start;
+	}
+
+	//  The plain loop the diff is measured against - one pixel at a time.
+	int16_t naiveFirstDifference(const uint16_t *pA, const uint16_t *pB, int16_t from, int16_t to)
+	{
+		while ((from < to) && (pA[from] == pB[from])) from++;
+		return from;
+	}
+}
+
+int main()
+{
+	tft.begin();
+
+	Waveshare_ILI9486_DoubleBuffer buffer(WIDTH, HEIGHT);
+	if (!buffer.begin()) return 1;
+
+	const Frame before = background();
+	std::vector<Change> list = changes(before);
+
+	Waveshare_ILI9486_Benchmark<> benchmark(Serial, "host");
+	benchmark.printHeader();
+
+	for (Change &change : list)
+	{
+		//  Pixels to flip back and forth between the two frames.
+		std::vector<uint32_t> changed;
+		for (uint32_t i = 0; i < PIXELS; i++)
+		{
+			if (before[i] != change.after[i]) changed.push_back(i);
+		}
+
+		memcpy(buffer.getBuffer(), before.data(), PIXELS * sizeof(uint16_t));
+		buffer.invalidate();
+		buffer.present();
+
+		//  Bytes for one present, checked against the model below at the library's gap.
+		memcpy(buffer.getBuffer(), change.after.data(), PIXELS * sizeof(uint16_t));
+		forgetWindow();
+		uint32_t bytes = Waveshare_ILI9486_Impl::hostBytesWritten();
+		buffer.present();
+		bytes = Waveshare_ILI9486_Impl::hostBytesWritten() - bytes;
+
+		Frame after = change.after;
+		const uint32_t modelBytes = presentWithGap(before, after, Waveshare_ILI9486_DoubleBuffer::SPAN_MERGE_GAP);
+		if (bytes != modelBytes)
+		{
+			printf("%s: present() sent %lu bytes, the model %lu\n", change.pName,
+				(unsigned long)bytes, (unsigned long)modelBytes);
+			return 1;
+		}
+
+		//  Time includes writing the changed pixels into the back buffer.
+		bool toAfter = false;
+		char name[48];
+		snprintf(name, sizeof(name), "present_%s_%lu_bytes", change.pName, (unsigned long)bytes);
+		benchmark.run(name, 32, PIXELS, [&]()
+		{
+			uint16_t *pBack = buffer.getBuffer();
+			const Frame &target = toAfter ? change.after : before;
+			for (uint32_t i : changed)
+			{
+				pBack[i] = target[i];
+			}
+			toAfter = !toAfter;
+			buffer.present();
+		});
+	}
+
+	//  The diff alone on identical frames, against a pixel at a time.
+	Frame same = before;
+	volatile int16_t sink = 0;
+	benchmark.run("scan_naive", 32, PIXELS, [&]()
+	{
+		for (int16_t row = 0; row < HEIGHT; row++)
+		{
+			sink = naiveFirstDifference(before.data() + row * WIDTH, same.data() + row * WIDTH, 0, WIDTH);
+		}
+	});
+
+	//  Bytes for each change at each merge gap.  A gap pixel costs 2 bytes and a new span
+	//  on the same row 12 (the column half of the window, and RAMWR), so merging gaps of
+	//  up to 6 never costs bytes - at 6 the two tie.  Fails if SPAN_MERGE_GAP isn't among
+	//  the least for every change.
+	printf("\nbytes sent by merge gap\nchange");
+	static const int16_t gaps[] = { 0, 2, 4, 5, 6, 7, 8, 12, 16, 32 };
+	constexpr uint8_t GAP_COUNT = sizeof(gaps) / sizeof(gaps[0]);
+	for (int16_t gap : gaps)
+	{
+		printf(",gap_%d", gap);
+	}
+	printf(",least_at\n");
+
+	for (Change &change : list)
+	{
+		uint32_t bytes[GAP_COUNT];
+		uint32_t least = UINT32_MAX;
+
+		printf("%s", change.pName);
+		for (uint8_t i = 0; i < GAP_COUNT; i++)
+		{
+			Frame after = change.after;
+			bytes[i] = presentWithGap(before, after, gaps[i]);
+			least = min(least, bytes[i]);
+			printf(",%lu", (unsigned long)bytes[i]);
+		}
+
+		printf(",");
+		bool chosenIsLeast = false;
+		for (uint8_t i = 0; i < GAP_COUNT; i++)
+		{
+			if (bytes[i] != least) continue;
+			printf(" %d", gaps[i]);
+			chosenIsLeast = chosenIsLeast || (gaps[i] == Waveshare_ILI9486_DoubleBuffer::SPAN_MERGE_GAP);
+		}
+		printf("\n");
+
+		if (!chosenIsLeast)
+		{
+			printf("SPAN_MERGE_GAP (%d) isn't the least for %s\n",
+				Waveshare_ILI9486_DoubleBuffer::SPAN_MERGE_GAP, change.pName);
+			return 1;
+		}
+	}
+
+	return 0;
+}
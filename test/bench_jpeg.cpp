@@ -0,0 +1,74 @@
+//  JPEG decode throughput on the host, for a full screen (320x480) image at each scale.
+//  The decoded blocks go nowhere, so this is the decoder alone.  Prints the library's
+//  benchmark CSV.
+
+#include <Arduino.h>
+#include <vector>
+#include <Waveshare_ILI9486_Benchmark.h>
+#include <Waveshare_ILI9486_Jpeg.h>
+
+#include "jpeg_reference.h"
+
+namespace
+{
+	void
+	discardBlock(
+		void *pContext,
+		int16_t x,
+		int16_t y,
+		int16_t w,
+		int16_t h,
+		const uint16_t *pColors,
+		int16_t stride)
+	{
+	}
+
+	struct Image
+	{
+		const char *pName;
+		int components;
+		int hSampling;
+		int vSampling;
+		JpegPattern pattern;
+	};
+
+	const Image images[] =
+	{
+		{ "gray", 1, 1, 1, PATTERN_SMOOTH },
+		{ "444", 3, 1, 1, PATTERN_SMOOTH },
+		{ "422", 3, 2, 1, PATTERN_SMOOTH },
+		{ "420", 3, 2, 2, PATTERN_SMOOTH },
+		{ "420_noisy", 3, 2, 2, PATTERN_NOISY },
+	};
+
+	const char *const scaleNames[] = { "1", "1/2", "1/4", "1/8" };
+}
+
+int main()
+{
+	Waveshare_ILI9486_Benchmark<> benchmark(Serial, "host");
+	benchmark.printHeader();
+
+	for (const Image &image : images)
+	{
+		const std::vector<uint8_t> file = encodeJpeg(320, 480, image.components, image.hSampling,
+			image.vSampling, 80, 0, image.pattern, 1);
+
+		for (uint8_t s = Waveshare_ILI9486_Jpeg::SCALE_1; s <= Waveshare_ILI9486_Jpeg::SCALE_1_8; s++)
+		{
+			const Waveshare_ILI9486_Jpeg::Scale scale = Waveshare_ILI9486_Jpeg::Scale(s);
+			Waveshare_ILI9486_Jpeg jpeg;
+			char name[32];
+
+			//  Pixels decoded, not drawn - the rate is the work done per source pixel.
+			snprintf(name, sizeof(name), "jpeg_%s_%s", image.pName, scaleNames[s]);
+			benchmark.run(name, 20, 320UL * 480, [&]()
+			{
+				jpeg.begin(file.data(), file.size());
+				jpeg.decode(discardBlock, NULL, 0, 0, scale);
+			});
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,110 @@
+//  The RGB888 and ARGB8888 conversion kernels on the host, against converting a byte at
+//  a time, and against the bus.  At the 20 MHz write clock a pixel (16 bits) takes
+//  800 ns to send, so the last column - the share of that the conversion takes - is
+//  what decides whether a faster kernel (SIMD, say) would be worth having.  On the
+//  host a pixel is sent nowhere, so the time is the conversion and chunking alone.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <vector>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_Benchmark.h>
+
+namespace
+{
+	constexpr int16_t WIDTH = 320;
+	constexpr int16_t HEIGHT = 480;
+	constexpr uint32_t PIXELS = (uint32_t)WIDTH * HEIGHT;
+
+	//  Nanoseconds to send one pixel at 20 MHz.
+	constexpr double BUS_NS_PER_PIXEL = 16 * 1e9 / 20000000;
+
+	uint32_t random32(uint32_t &state)
+	{
+		state = state * 1664525 + 1013904223;
+		return state >> 8;
+	}
+
+	//  The plain version - a byte at a time into a chunk, the way the kernels send.
+	uint16_t bytewise(const uint8_t *pRGB, uint32_t count)
+	{
+		uint16_t chunk[32];
+		uint16_t check = 0;
+		uint8_t used = 0;
+
+		for (uint32_t i = 0; i < count; i++, pRGB += 3)
+		{
+			chunk[used++] = ((pRGB[0] & 0xF8) << 8) | ((pRGB[1] & 0xFC) << 3) | (pRGB[2] >> 3);
+			if (used == 32)
+			{
+				check ^= chunk[31];
+				used = 0;
+			}
+		}
+		return check;
+	}
+
+	template<class Benchmark, class Function>
+	void
+	report(
+		Benchmark &benchmark,
+		const char *pName,
+		Function function)
+	{
+		const auto result = benchmark.run(pName, 32, PIXELS, function);
+		const double ns = result.median * 1000.0 / PIXELS;
+		printf("    %.2f ns a pixel, %.2f%% of its time on the bus - a core %.0f times slower would keep up\n",
+			ns, 100.0 * ns / BUS_NS_PER_PIXEL, BUS_NS_PER_PIXEL / ns);
+	}
+}
+
+int main()
+{
+	Waveshare_ILI9486 tft;
+	tft.begin();
+
+	std::vector<uint8_t> rgb(3 * PIXELS);
+	std::vector<uint32_t> opaque(PIXELS);
+	std::vector<uint32_t> mixed(PIXELS);
+	uint32_t state = 1;
+	for (uint32_t i = 0; i < PIXELS; i++)
+	{
+		const uint32_t color = random32(state) & 0xFFFFFF;
+		rgb[3 * i] = color >> 16;
+		rgb[3 * i + 1] = color >> 8;
+		rgb[3 * i + 2] = color;
+		opaque[i] = 0xFF000000 | color;
+
+		//  A quarter each fully transparent and fully opaque, the rest in between.
+		const uint32_t alpha = random32(state) & 0xFF;
+		mixed[i] = (((alpha < 64) ? 0 : (alpha > 191) ? 0xFF : alpha) << 24) | color;
+	}
+
+	Waveshare_ILI9486_Benchmark<> benchmark(Serial, "host");
+	benchmark.printHeader();
+
+	volatile uint16_t sink = 0;
+	report(benchmark, "rgb888_bytewise", [&]()
+	{
+		sink = bytewise(rgb.data(), PIXELS);
+	});
+	report(benchmark, "rgb888", [&]()
+	{
+		tft.drawRGB888(0, 0, rgb.data(), WIDTH, HEIGHT);
+	});
+	report(benchmark, "argb8888", [&]()
+	{
+		tft.drawARGB8888(0, 0, opaque.data(), WIDTH, HEIGHT);
+	});
+	report(benchmark, "argb8888_blend_opaque", [&]()
+	{
+		tft.drawARGB8888(0, 0, opaque.data(), WIDTH, HEIGHT, 0x1234);
+	});
+	report(benchmark, "argb8888_blend_mixed", [&]()
+	{
+		tft.drawARGB8888(0, 0, mixed.data(), WIDTH, HEIGHT, 0x1234);
+	});
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+//  Minimal test assertions for the host tests.  A failed check is reported and counted,
+//  and 'checkResult()' turns the count into main's return value.
+
+#ifndef _WAVESHARE_ILI9486_TEST_CHECK_h
+#define _WAVESHARE_ILI9486_TEST_CHECK_h
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+			checkFailures++; \
+		} \
+	} while (0)
+
+#define CHECK_EQUAL(actual, expected) \
+	do \
+	{ \
+		const auto checkActual = (actual); \
+		const auto checkExpected = (expected); \
+		if (!(checkActual == checkExpected)) \
+		{ \
+			printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, \
+				(long long)checkActual, (long long)checkExpected); \
+			checkFailures++; \
+		} \
+	} while (0)
+
+static inline int checkResult()
+{
+	if (checkFailures == 0) printf("passed\n");
+	return (checkFailures == 0) ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,181 @@
+//  Host build stand-in for Adafruit GFX, see Adafruit_GFX.h.
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+	:WIDTH(w), HEIGHT(h), _width(w), _height(h), cursor_x(0), cursor_y(0),
+	textcolor(0xFFFF), textbgcolor(0xFFFF), textsize_x(1), textsize_y(1), rotation(0),
+	wrap(true), _cp437(false), gfxFont(nullptr)
+{
+}
+
+void
+Adafruit_GFX::setRotation(uint8_t r)
+{
+	rotation = r & 3;
+	_width = (rotation & 1) ? HEIGHT : WIDTH;
+	_height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+//  Bresenham, as in Adafruit_GFX.cpp.
+void
+Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	const bool steep = abs(y1 - y0) > abs(x1 - x0);
+	int16_t t;
+	if (steep)
+	{
+		t = x0; x0 = y0; y0 = t;
+		t = x1; x1 = y1; y1 = t;
+	}
+	if (x0 > x1)
+	{
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+	}
+
+	const int16_t dx = x1 - x0;
+	const int16_t dy = abs(y1 - y0);
+	const int16_t step = (y0 < y1) ? 1 : -1;
+	int16_t err = dx / 2;
+	for (; x0 <= x1; x0++)
+	{
+		if (steep) writePixel(y0, x0, color);
+		else writePixel(x0, y0, color);
+
+		err -= dy;
+		if (err < 0)
+		{
+			y0 += step;
+			err += dx;
+		}
+	}
+}
+
+void
+Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+{
+	startWrite();
+	writeLine(x, y, x, y + h - 1, color);
+	endWrite();
+}
+
+void
+Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+{
+	startWrite();
+	writeLine(x, y, x + w - 1, y, color);
+	endWrite();
+}
+
+void
+Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	startWrite();
+	for (int16_t i = x; i < x + w; i++)
+	{
+		writeFastVLine(i, y, h, color);
+	}
+	endWrite();
+}
+
+void
+Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	startWrite();
+	writeLine(x0, y0, x1, y1, color);
+	endWrite();
+}
+
+void
+Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	startWrite();
+	writeFastHLine(x, y, w, color);
+	writeFastHLine(x, y + h - 1, w, color);
+	writeFastVLine(x, y, h, color);
+	writeFastVLine(x + w - 1, y, h, color);
+	endWrite();
+}
+
+void
+Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size)
+{
+	drawChar(x, y, c, color, bg, size, size);
+}
+
+//  Classic 6 x 8 cell, drawn the way Adafruit draws it, but the glyph bits are made up
+//  from the character code.
+void
+Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg,
+	uint8_t sizeX, uint8_t sizeY)
+{
+	startWrite();
+	for (int8_t i = 0; i < 5; i++)
+	{
+		uint8_t line = (uint8_t)(c * 37 + i * 11);
+		for (int8_t j = 0; j < 8; j++, line >>= 1)
+		{
+			if ((line & 1) || (bg != color))
+			{
+				const uint16_t ink = (line & 1) ? color : bg;
+				if ((sizeX == 1) && (sizeY == 1)) writePixel(x + i, y + j, ink);
+				else writeFillRect(x + i * sizeX, y + j * sizeY, sizeX, sizeY, ink);
+			}
+		}
+	}
+	if (bg != color)
+	{
+		if ((sizeX == 1) && (sizeY == 1)) writeFastVLine(x + 5, y, 8, bg);
+		else writeFillRect(x + 5 * sizeX, y, sizeX, 8 * sizeY, bg);
+	}
+	endWrite();
+}
+
+void
+Adafruit_GFX::getTextBounds(const char *s, int16_t x, int16_t y, int16_t *pX, int16_t *pY,
+	uint16_t *pW, uint16_t *pH)
+{
+	*pX = x;
+	*pY = y;
+	*pW = 6 * strlen(s) * textsize_x;
+	*pH = 8 * textsize_y;
+}
+
+size_t
+Adafruit_GFX::write(uint8_t c)
+{
+	drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize_x, textsize_y);
+	cursor_x += 6 * textsize_x;
+	return 1;
+}
+
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h)
+	:Adafruit_GFX(w, h)
+{
+	buffer = (uint8_t *)calloc((size_t)((w + 7) / 8) * h, 1);
+}
+
+GFXcanvas1::~GFXcanvas1()
+{
+	free(buffer);
+}
+
+void
+GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color)
+{
+	if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height)) return;
+
+	uint8_t *p = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+	if (color) *p |= 0x80 >> (x & 7);
+	else *p &= ~(0x80 >> (x & 7));
+}
+
+void
+GFXcanvas1::fillScreen(uint16_t color)
+{
+	memset(buffer, color ? 0xFF : 0x00, (size_t)((WIDTH + 7) / 8) * HEIGHT);
+}
@@ -0,0 +1,102 @@
+//  Host build stand-in for Adafruit GFX.
+//  - The parts of the interface the library and its tests use.
+//
+//  Lines and rectangles follow Adafruit's own code.  There's no font - text comes out
+//  as made up 5 x 8 glyphs, the right size and shape for layout, but not readable.
+//  The bitmap and triangle helpers the driver doesn't override draw nothing.
+
+#ifndef _WAVESHARE_ILI9486_HOST_ADAFRUIT_GFX_h
+#define _WAVESHARE_ILI9486_HOST_ADAFRUIT_GFX_h
+
+#include <Arduino.h>
+
+struct GFXfont;
+
+class Adafruit_GFX : public Print
+{
+public:
+	Adafruit_GFX(int16_t w, int16_t h);
+
+	virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+	virtual void startWrite() {}
+	virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+	virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) { fillRect(x, y, w, h, color); }
+	virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+	virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+	virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+	virtual void endWrite() {}
+
+	virtual void setRotation(uint8_t r);
+	virtual void invertDisplay(boolean) {}
+
+	virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+	virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+	virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+	virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+	virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+	virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+	void fillCircle(int16_t, int16_t, int16_t, uint16_t) {}
+	void fillTriangle(int16_t, int16_t, int16_t, int16_t, int16_t, int16_t, uint16_t) {}
+	void drawBitmap(int16_t, int16_t, const uint8_t[], int16_t, int16_t, uint16_t) {}
+	void drawBitmap(int16_t, int16_t, const uint8_t[], int16_t, int16_t, uint16_t, uint16_t) {}
+	void drawBitmap(int16_t, int16_t, uint8_t *, int16_t, int16_t, uint16_t) {}
+	void drawBitmap(int16_t, int16_t, uint8_t *, int16_t, int16_t, uint16_t, uint16_t) {}
+	void drawGrayscaleBitmap(int16_t, int16_t, const uint8_t[], int16_t, int16_t) {}
+	void drawGrayscaleBitmap(int16_t, int16_t, uint8_t *, int16_t, int16_t) {}
+	void drawGrayscaleBitmap(int16_t, int16_t, const uint8_t[], const uint8_t[], int16_t, int16_t) {}
+	void drawGrayscaleBitmap(int16_t, int16_t, uint8_t *, uint8_t *, int16_t, int16_t) {}
+	void drawRGBBitmap(int16_t, int16_t, const uint16_t[], int16_t, int16_t) {}
+	void drawRGBBitmap(int16_t, int16_t, uint16_t *, int16_t, int16_t) {}
+	void drawRGBBitmap(int16_t, int16_t, const uint16_t[], const uint8_t[], int16_t, int16_t) {}
+	void drawRGBBitmap(int16_t, int16_t, uint16_t *, uint8_t *, int16_t, int16_t) {}
+
+	void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t size);
+	void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint16_t bg, uint8_t sizeX, uint8_t sizeY);
+	void getTextBounds(const char *s, int16_t x, int16_t y, int16_t *pX, int16_t *pY, uint16_t *pW, uint16_t *pH);
+	virtual size_t write(uint8_t c);
+	using Print::write;
+
+	void setTextSize(uint8_t s) { textsize_x = textsize_y = s; }
+	void setTextSize(uint8_t sx, uint8_t sy) { textsize_x = sx; textsize_y = sy; }
+	void setFont(const GFXfont *f = nullptr) { gfxFont = (GFXfont *)f; }
+	void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+	void setTextColor(uint16_t c) { textcolor = textbgcolor = c; }
+	void setTextColor(uint16_t c, uint16_t bg) { textcolor = c; textbgcolor = bg; }
+	void setTextWrap(boolean w) { wrap = w; }
+	void cp437(boolean x = true) { _cp437 = x; }
+
+	int16_t width() const { return _width; }
+	int16_t height() const { return _height; }
+	uint8_t getRotation() const { return rotation; }
+	int16_t getCursorX() const { return cursor_x; }
+	int16_t getCursorY() const { return cursor_y; }
+
+protected:
+	int16_t WIDTH, HEIGHT;
+	int16_t _width, _height;
+	int16_t cursor_x, cursor_y;
+	uint16_t textcolor, textbgcolor;
+	uint8_t textsize_x, textsize_y;
+	uint8_t rotation;
+	boolean wrap;
+	boolean _cp437;
+	GFXfont *gfxFont;
+};
+
+class GFXcanvas1 : public Adafruit_GFX
+{
+public:
+	GFXcanvas1(uint16_t w, uint16_t h);
+	~GFXcanvas1();
+
+	void drawPixel(int16_t x, int16_t y, uint16_t color);
+	void fillScreen(uint16_t color);
+	uint8_t *getBuffer() const { return buffer; }
+
+private:
+	uint8_t *buffer;
+};
+
+#endif
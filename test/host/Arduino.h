@@ -0,0 +1,81 @@
+//  Host build stand-in for the Arduino core.
+//  - Just enough for the library to build and run on a desktop, see test/CMakeLists.txt.
+//
+//  Pins do nothing, PROGMEM is ordinary memory, Serial writes to stdout.  'micros()'
+//  and 'millis()' are the host's steady clock, plus whatever 'delay()' has asked for -
+//  delays don't sleep, so a display 'begin()' costs nothing.
+
+#ifndef _WAVESHARE_ILI9486_HOST_ARDUINO_h
+#define _WAVESHARE_ILI9486_HOST_ARDUINO_h
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis();
+unsigned long micros();
+void yield();
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+template<class T> T min(T a, T b) { return (a < b) ? a : b; }
+template<class T> T max(T a, T b) { return (a > b) ? a : b; }
+
+class Print
+{
+public:
+	virtual ~Print() {}
+	virtual size_t write(uint8_t c) = 0;
+
+	size_t write(const char *s);
+	size_t print(const char *s) { return write(s); }
+	size_t print(char c) { return write((uint8_t)c); }
+	size_t print(long value, int base = DEC);
+	size_t print(unsigned long value, int base = DEC);
+	size_t print(int value, int base = DEC) { return print((long)value, base); }
+	size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+	size_t print(double value, int digits = 2);
+	size_t println() { return write("\r\n"); }
+	template<class T> size_t println(T value) { const size_t n = print(value); return n + println(); }
+	template<class T> size_t println(T value, int format) { const size_t n = print(value, format); return n + println(); }
+};
+
+class HardwareSerial : public Print
+{
+public:
+	void begin(unsigned long) {}
+	size_t write(uint8_t c) { return (size_t)(putchar(c) != EOF); }
+	using Print::write;
+	operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif
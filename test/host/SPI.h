@@ -0,0 +1,36 @@
+//  Host build stand-in for the Arduino SPI library.
+//  - Transactions are counted, nothing is sent and every read is 0.
+//
+//  The display itself goes through HostTransport (WAVESHARE_ILI9486_HOST), so only the
+//  touch screen and transaction handling end up here.
+
+#ifndef _WAVESHARE_ILI9486_HOST_SPI_h
+#define _WAVESHARE_ILI9486_HOST_SPI_h
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPISettings
+{
+public:
+	SPISettings() {}
+	SPISettings(uint32_t, uint8_t, uint8_t) {}
+};
+
+class SPIClass
+{
+public:
+	void begin() {}
+	void beginTransaction(SPISettings) { transactions++; }
+	void endTransaction() {}
+	uint8_t transfer(uint8_t) { return 0; }
+	uint16_t transfer16(uint16_t) { return 0; }
+
+	unsigned long transactions = 0;
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,87 @@
+//  Host build stand-in for the Arduino core and SPI library, see Arduino.h and SPI.h.
+
+#include <Arduino.h>
+#include <SPI.h>
+
+#include <chrono>
+
+
+HardwareSerial Serial;
+SPIClass SPI;
+
+namespace
+{
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+	//  Time 'delay()' has skipped over, in microseconds.
+	unsigned long delayed = 0;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }
+int analogRead(uint8_t) { return 0; }
+void analogWrite(uint8_t, int) {}
+
+unsigned long micros()
+{
+	const auto elapsed = std::chrono::steady_clock::now() - start;
+	return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + delayed;
+}
+
+unsigned long millis()
+{
+	return micros() / 1000;
+}
+
+void delay(unsigned long ms)
+{
+	delayed += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	delayed += us;
+}
+
+void yield() {}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax)
+{
+	return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+size_t
+Print::write(const char *s)
+{
+	size_t n = 0;
+	while (*s)
+	{
+		n += write((uint8_t)*s++);
+	}
+	return n;
+}
+
+size_t
+Print::print(long value, int base)
+{
+	char text[24];
+	snprintf(text, sizeof(text), (base == HEX) ? "%lX" : "%ld", value);
+	return write(text);
+}
+
+size_t
+Print::print(unsigned long value, int base)
+{
+	char text[24];
+	snprintf(text, sizeof(text), (base == HEX) ? "%lX" : "%lu", value);
+	return write(text);
+}
+
+size_t
+Print::print(double value, int digits)
+{
+	char text[64];
+	snprintf(text, sizeof(text), "%.*f", digits, value);
+	return write(text);
+}
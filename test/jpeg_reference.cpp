@@ -0,0 +1,127 @@
+//  libjpeg, for the JPEG decoder tests.
+
+#include "jpeg_reference.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <jpeglib.h>
+
+std::vector<uint8_t>
+encodeJpeg(
+	int width,
+	int height,
+	int components,
+	int hSampling,
+	int vSampling,
+	int quality,
+	int restartInterval,
+	JpegPattern pattern,
+	unsigned seed)
+{
+	jpeg_compress_struct compress;
+	jpeg_error_mgr error;
+	compress.err = jpeg_std_error(&error);
+	jpeg_create_compress(&compress);
+
+	unsigned char *pBuffer = NULL;
+	unsigned long size = 0;
+	jpeg_mem_dest(&compress, &pBuffer, &size);
+
+	compress.image_width = width;
+	compress.image_height = height;
+	compress.input_components = components;
+	compress.in_color_space = (components == 3) ? JCS_RGB : JCS_GRAYSCALE;
+	jpeg_set_defaults(&compress);
+	jpeg_set_quality(&compress, quality, TRUE);
+	if (components == 3)
+	{
+		compress.comp_info[0].h_samp_factor = hSampling;
+		compress.comp_info[0].v_samp_factor = vSampling;
+	}
+	compress.restart_interval = restartInterval;
+	jpeg_start_compress(&compress, TRUE);
+
+	srand(seed);
+	std::vector<uint8_t> row(width * components);
+	while (compress.next_scanline < compress.image_height)
+	{
+		const int y = compress.next_scanline;
+
+		for (int x = 0; x < width; x++)
+		{
+			for (int k = 0; k < components; k++)
+			{
+				uint8_t &sample = row[x * components + k];
+
+				switch (pattern)
+				{
+				case PATTERN_NOISY:
+					sample = uint8_t(((x * (k + 1) * 7 + y * 5 * (3 - k)) ^ (x * y >> 3)) + rand() % 40);
+					break;
+
+				case PATTERN_SMOOTH:
+					sample = uint8_t(128 + 100 * sin((x * (k + 1) + y * (3 - k)) * 0.05));
+					break;
+
+				case PATTERN_CHECKER:
+					sample = ((x + y + k) & 1) ? 255 : 0;
+					break;
+				}
+			}
+		}
+
+		JSAMPROW pRow = row.data();
+		jpeg_write_scanlines(&compress, &pRow, 1);
+	}
+
+	jpeg_finish_compress(&compress);
+	jpeg_destroy_compress(&compress);
+
+	std::vector<uint8_t> file(pBuffer, pBuffer + size);
+	free(pBuffer);
+	return file;
+}
+
+std::vector<uint16_t>
+decodeJpegReference(
+	const std::vector<uint8_t> &file,
+	int scaleDenominator,
+	int &width,
+	int &height)
+{
+	jpeg_decompress_struct decompress;
+	jpeg_error_mgr error;
+	decompress.err = jpeg_std_error(&error);
+	jpeg_create_decompress(&decompress);
+
+	jpeg_mem_src(&decompress, file.data(), file.size());
+	jpeg_read_header(&decompress, TRUE);
+	decompress.dct_method = JDCT_ISLOW;
+	decompress.do_fancy_upsampling = FALSE;
+	decompress.out_color_space = JCS_RGB;
+	decompress.scale_num = 1;
+	decompress.scale_denom = scaleDenominator;
+	jpeg_start_decompress(&decompress);
+
+	width = decompress.output_width;
+	height = decompress.output_height;
+
+	std::vector<uint16_t> pixels(width * height);
+	std::vector<uint8_t> row(width * 3);
+	while (decompress.output_scanline < decompress.output_height)
+	{
+		const int y = decompress.output_scanline;
+		JSAMPROW pRow = row.data();
+		jpeg_read_scanlines(&decompress, &pRow, 1);
+
+		for (int x = 0; x < width; x++)
+		{
+			pixels[y * width + x] = ((row[x * 3] & 0xF8) << 8) | ((row[x * 3 + 1] & 0xFC) << 3) | (row[x * 3 + 2] >> 3);
+		}
+	}
+
+	jpeg_finish_decompress(&decompress);
+	jpeg_destroy_decompress(&decompress);
+	return pixels;
+}
@@ -0,0 +1,28 @@
+//  libjpeg, for the JPEG decoder tests - test images, and the output to compare against.
+//  Kept apart from Arduino.h, whose 'boolean' clashes with jpeglib.h.
+
+#ifndef _WAVESHARE_ILI9486_TEST_JPEG_REFERENCE_h
+#define _WAVESHARE_ILI9486_TEST_JPEG_REFERENCE_h
+
+#include <stdint.h>
+#include <vector>
+
+//  Encodes a width x height test image.  'components' is 1 (gray) or 3, and the luma
+//  sampling factors 'hSampling' x 'vSampling' give 4:4:4 (1x1), 4:2:2 (2x1) or 4:2:0
+//  (2x2).  'restartInterval' is in MCUs, 0 for none.
+enum JpegPattern
+{
+	PATTERN_NOISY,      //  Gradients plus noise from 'seed'.
+	PATTERN_SMOOTH,     //  Sine waves.
+	PATTERN_CHECKER     //  0 / 255 one pixel checkerboard - the largest coefficients.
+};
+
+std::vector<uint8_t> encodeJpeg(int width, int height, int components, int hSampling, int vSampling,
+	int quality, int restartInterval, JpegPattern pattern, unsigned seed);
+
+//  libjpeg's decode of 'file' at 1/'scaleDenominator', with the integer slow IDCT and no
+//  fancy upsampling, as RGB565.  Sets 'width' and 'height' to the output size.
+std::vector<uint16_t> decodeJpegReference(const std::vector<uint8_t> &file, int scaleDenominator,
+	int &width, int &height);
+
+#endif
@@ -0,0 +1,103 @@
+//  CommandRing with a real producer and consumer thread.  Every item carries a sequence
+//  number and a payload derived from it, so a lost, repeated, reordered or torn item
+//  shows up at the consumer.
+
+#include <stdint.h>
+#include <thread>
+#include <Waveshare_ILI9486_CommandRing.h>
+
+#include "check.h"
+
+namespace
+{
+	//  Bigger than a word, so a half published item would be caught.
+	struct Item
+	{
+		uint32_t sequence;
+		uint32_t payload[5];
+	};
+
+	template<uint16_t SIZE>
+	void
+	pass(
+		uint32_t count)
+	{
+		Waveshare_ILI9486_CommandRing<Item, SIZE> ring;
+		uint32_t outOfOrder = 0;
+		uint32_t torn = 0;
+
+		std::thread producer([&]()
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				Item item;
+				item.sequence = i;
+				for (uint8_t k = 0; k < 5; k++)
+				{
+					item.payload[k] = i * 31 + k;
+				}
+
+				while (!ring.push(item))
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+
+		std::thread consumer([&]()
+		{
+			for (uint32_t i = 0; i < count; i++)
+			{
+				Item item;
+				while (!ring.pop(item))
+				{
+					std::this_thread::yield();
+				}
+
+				outOfOrder += (item.sequence != i);
+				for (uint8_t k = 0; k < 5; k++)
+				{
+					torn += (item.payload[k] != item.sequence * 31 + k);
+				}
+			}
+		});
+
+		producer.join();
+		consumer.join();
+
+		printf("ring of %u, %lu items: %lu out of order, %lu torn\n", SIZE, (unsigned long)count,
+			(unsigned long)outOfOrder, (unsigned long)torn);
+		CHECK_EQUAL(outOfOrder, 0U);
+		CHECK_EQUAL(torn, 0U);
+		CHECK(ring.empty());
+	}
+}
+
+int main()
+{
+	//  One thread: fills to exactly SIZE, and hands items back in order.
+	Waveshare_ILI9486_CommandRing<Item, 4> small;
+	Item item = {};
+	CHECK(small.empty());
+	CHECK(!small.pop(item));
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		item.sequence = i;
+		CHECK(small.push(item));
+	}
+	CHECK(!small.push(item));
+	CHECK_EQUAL(small.size(), 4);
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		CHECK(small.pop(item));
+		CHECK_EQUAL(item.sequence, i);
+	}
+	CHECK(small.empty());
+
+	//  Two threads.  The small ring is full or empty most of the time, the large one
+	//  wraps its slots thousands of times.
+	pass<2>(200000);
+	pass<64>(1000000);
+
+	return checkResult();
+}
@@ -0,0 +1,32 @@
+//  The host build itself - HostTransport counts exactly what the panel would be sent.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Waveshare_ILI9486.h>
+
+#include "check.h"
+
+int main()
+{
+	Waveshare_ILI9486 tft;
+	CHECK(tft.begin());
+
+	//  A full screen fill is one window (two 4 parameter commands), RAMWR, and the
+	//  pixels.  Every command and parameter is a 16 bit frame.
+	uint32_t before = Waveshare_ILI9486_Impl::hostBytesWritten();
+	tft.fillScreen(0x1234);
+	CHECK_EQUAL(Waveshare_ILI9486_Impl::hostBytesWritten() - before, 2UL * (5 + 5 + 1) + 2UL * 320 * 480);
+
+	//  Same window again - the address registers are cached, so just RAMWR.
+	before = Waveshare_ILI9486_Impl::hostBytesWritten();
+	tft.fillScreen(0x4321);
+	CHECK_EQUAL(Waveshare_ILI9486_Impl::hostBytesWritten() - before, 2UL * 1 + 2UL * 320 * 480);
+
+	//  Nothing at all for something off screen.
+	before = Waveshare_ILI9486_Impl::hostBytesWritten();
+	tft.fillRect(400, 600, 10, 10, 0xFFFF);
+	CHECK_EQUAL(Waveshare_ILI9486_Impl::hostBytesWritten() - before, 0UL);
+
+	return checkResult();
+}
@@ -0,0 +1,162 @@
+//  The JPEG decoder against libjpeg (JDCT_ISLOW, no fancy upsampling), bit-exact at
+//  full size and at 1/2, 1/4 and 1/8.  Every output pixel must be written exactly once.
+//  Then truncated files.
+
+#include <Arduino.h>
+#include <vector>
+#include <Waveshare_ILI9486_Jpeg.h>
+
+#include "check.h"
+#include "jpeg_reference.h"
+
+namespace
+{
+	//  Where the decoder is asked to put the image, to check the offsets are applied.
+	constexpr int16_t ORIGIN_X = 5;
+	constexpr int16_t ORIGIN_Y = 7;
+
+	struct Canvas
+	{
+		int width;
+		int height;
+		std::vector<uint16_t> pixels;
+		std::vector<uint8_t> writes;
+		bool outside;
+	};
+
+	void
+	writeBlock(
+		void *pContext,
+		int16_t x,
+		int16_t y,
+		int16_t w,
+		int16_t h,
+		const uint16_t *pColors,
+		int16_t stride)
+	{
+		Canvas *pCanvas = (Canvas *)pContext;
+
+		for (int j = 0; j < h; j++)
+		{
+			for (int i = 0; i < w; i++)
+			{
+				const int cx = x + i - ORIGIN_X;
+				const int cy = y + j - ORIGIN_Y;
+
+				if (cx < 0 || cy < 0 || cx >= pCanvas->width || cy >= pCanvas->height)
+				{
+					pCanvas->outside = true;
+					continue;
+				}
+				pCanvas->writes[cy * pCanvas->width + cx]++;
+				pCanvas->pixels[cy * pCanvas->width + cx] = pColors[j * stride + i];
+			}
+		}
+	}
+
+	struct Case
+	{
+		int width;
+		int height;
+		int components;
+		int hSampling;
+		int vSampling;
+		int quality;
+		int restartInterval;
+		JpegPattern pattern;
+	};
+
+	const Case cases[] =
+	{
+		//  Gray.
+		{ 64, 48, 1, 1, 1, 90, 0, PATTERN_NOISY },
+		{ 37, 29, 1, 1, 1, 75, 3, PATTERN_NOISY },
+		{ 40, 24, 1, 1, 1, 100, 0, PATTERN_CHECKER },
+		//  4:4:4, 4:2:2, and 4:4:0 (2 rows of luma to one of chroma).
+		{ 53, 41, 3, 1, 1, 85, 0, PATTERN_NOISY },
+		{ 53, 41, 3, 2, 1, 60, 0, PATTERN_SMOOTH },
+		{ 53, 41, 3, 2, 1, 70, 2, PATTERN_NOISY },
+		{ 53, 41, 3, 1, 2, 95, 0, PATTERN_SMOOTH },
+		{ 48, 32, 3, 1, 1, 100, 0, PATTERN_CHECKER },
+		//  4:2:0.
+		{ 101, 77, 3, 2, 2, 75, 0, PATTERN_SMOOTH },
+		{ 101, 77, 3, 2, 2, 50, 5, PATTERN_NOISY },
+		{ 17, 9, 3, 2, 2, 100, 1, PATTERN_SMOOTH },
+		{ 320, 240, 3, 2, 2, 80, 7, PATTERN_SMOOTH },
+		{ 8, 8, 3, 2, 2, 10, 0, PATTERN_SMOOTH },
+		{ 1, 1, 3, 2, 2, 75, 0, PATTERN_NOISY },
+		{ 35, 19, 3, 2, 2, 100, 0, PATTERN_CHECKER },
+		{ 35, 19, 3, 2, 2, 10, 0, PATTERN_CHECKER },
+	};
+}
+
+int main()
+{
+	for (unsigned n = 0; n < sizeof(cases) / sizeof(cases[0]); n++)
+	{
+		const Case &c = cases[n];
+		const std::vector<uint8_t> file = encodeJpeg(c.width, c.height, c.components, c.hSampling,
+			c.vSampling, c.quality, c.restartInterval, c.pattern, n);
+
+		for (uint8_t s = Waveshare_ILI9486_Jpeg::SCALE_1; s <= Waveshare_ILI9486_Jpeg::SCALE_1_8; s++)
+		{
+			const Waveshare_ILI9486_Jpeg::Scale scale = Waveshare_ILI9486_Jpeg::Scale(s);
+			int referenceWidth;
+			int referenceHeight;
+			const std::vector<uint16_t> reference = decodeJpegReference(file, 1 << s, referenceWidth, referenceHeight);
+
+			Waveshare_ILI9486_Jpeg jpeg;
+			jpeg.begin(file.data(), file.size());
+			CHECK(jpeg.readHeader());
+			CHECK_EQUAL(jpeg.width(), c.width);
+			CHECK_EQUAL(jpeg.height(), c.height);
+			CHECK_EQUAL(jpeg.width(scale), referenceWidth);
+			CHECK_EQUAL(jpeg.height(scale), referenceHeight);
+			if (jpeg.width(scale) != referenceWidth || jpeg.height(scale) != referenceHeight)
+			{
+				continue;
+			}
+
+			Canvas canvas;
+			canvas.width = referenceWidth;
+			canvas.height = referenceHeight;
+			canvas.pixels.assign(canvas.width * canvas.height, 0);
+			canvas.writes.assign(canvas.width * canvas.height, 0);
+			canvas.outside = false;
+			CHECK(jpeg.decode(writeBlock, &canvas, ORIGIN_X, ORIGIN_Y, scale));
+			CHECK(!canvas.outside);
+
+			int mismatched = 0;
+			for (int i = 0; i < canvas.width * canvas.height; i++)
+			{
+				CHECK_EQUAL(canvas.writes[i], 1);
+				mismatched += (canvas.pixels[i] != reference[i]);
+			}
+
+			printf("%3dx%-3d %d component %dx%d q%-3d restart %d  1/%d: %d of %d pixels differ\n",
+				c.width, c.height, c.components, c.hSampling, c.vSampling, c.quality, c.restartInterval,
+				1 << s, mismatched, canvas.width * canvas.height);
+			CHECK_EQUAL(mismatched, 0);
+		}
+	}
+
+	//  Truncated files fail, cleanly.
+	const std::vector<uint8_t> file = encodeJpeg(64, 64, 3, 2, 2, 75, 0, PATTERN_NOISY, 1);
+	const size_t lengths[] = { 0, 2, 100, file.size() / 2, file.size() - 2 };
+	for (size_t length : lengths)
+	{
+		Waveshare_ILI9486_Jpeg jpeg;
+		Canvas canvas;
+		canvas.width = 64;
+		canvas.height = 64;
+		canvas.pixels.assign(64 * 64, 0);
+		canvas.writes.assign(64 * 64, 0);
+		canvas.outside = false;
+
+		jpeg.begin(file.data(), length);
+		CHECK(!jpeg.decode(writeBlock, &canvas, ORIGIN_X, ORIGIN_Y));
+		CHECK(!canvas.outside);
+	}
+
+	return checkResult();
+}
@@ -0,0 +1,125 @@
+//  The JPEG decoder on damaged files.  Each run changes a few bytes of a good file and
+//  decodes it at every scale.  A decode may fail or draw garbage, but it must stay
+//  inside the image - and, built with the sanitizers, do nothing undefined on the way
+//  (overflowing the IDCT, say).
+
+#include <Arduino.h>
+#include <vector>
+#include <Waveshare_ILI9486_Jpeg.h>
+
+#include "check.h"
+#include "jpeg_reference.h"
+
+namespace
+{
+	constexpr int RUNS_PER_FILE = 400;
+
+	struct Bounds
+	{
+		int32_t width;
+		int32_t height;
+		bool outside;
+	};
+
+	void
+	writeBlock(
+		void *pContext,
+		int16_t x,
+		int16_t y,
+		int16_t w,
+		int16_t h,
+		const uint16_t *pColors,
+		int16_t stride)
+	{
+		Bounds *pBounds = (Bounds *)pContext;
+
+		if (x < 0 || y < 0 || w <= 0 || h <= 0 || stride < w ||
+			int32_t(x) + w > pBounds->width || int32_t(y) + h > pBounds->height)
+		{
+			pBounds->outside = true;
+			return;
+		}
+
+		//  Read every pixel, so ASan sees a block that runs off its buffer.
+		volatile uint16_t sum = 0;
+		for (int j = 0; j < h; j++)
+		{
+			for (int i = 0; i < w; i++)
+			{
+				sum += pColors[j * stride + i];
+			}
+		}
+	}
+
+	//  Same sequence everywhere, unlike rand().
+	uint32_t random32(uint32_t &state)
+	{
+		state = state * 1664525 + 1013904223;
+		return state >> 8;
+	}
+}
+
+int main()
+{
+	const std::vector<uint8_t> files[] =
+	{
+		encodeJpeg(40, 32, 1, 1, 1, 90, 2, PATTERN_NOISY, 1),
+		encodeJpeg(48, 32, 3, 2, 1, 100, 0, PATTERN_CHECKER, 2),
+		encodeJpeg(64, 48, 3, 2, 2, 75, 3, PATTERN_NOISY, 3),
+		//  Quality 1 has quantizers of 255, so garbage coefficients come out as large
+		//  as they can.
+		encodeJpeg(64, 48, 3, 2, 2, 1, 0, PATTERN_NOISY, 4),
+	};
+
+	uint32_t state = 1;
+	int decoded = 0;
+	int failed = 0;
+
+	for (const std::vector<uint8_t> &file : files)
+	{
+		for (int run = 0; run < RUNS_PER_FILE; run++)
+		{
+			std::vector<uint8_t> damaged = file;
+			const uint32_t changes = 1 + random32(state) % 4;
+
+			for (uint32_t n = 0; n < changes; n++)
+			{
+				uint8_t &byte = damaged[random32(state) % damaged.size()];
+
+				//  Half the time a single bit, which keeps most of the file decodable.
+				byte = (random32(state) & 1) ? byte ^ (1 << (random32(state) % 8)) : uint8_t(random32(state));
+			}
+
+			for (uint8_t s = Waveshare_ILI9486_Jpeg::SCALE_1; s <= Waveshare_ILI9486_Jpeg::SCALE_1_8; s++)
+			{
+				const Waveshare_ILI9486_Jpeg::Scale scale = Waveshare_ILI9486_Jpeg::Scale(s);
+				Waveshare_ILI9486_Jpeg jpeg;
+
+				jpeg.begin(damaged.data(), damaged.size());
+				if (!jpeg.readHeader())
+				{
+					failed++;
+					continue;
+				}
+
+				Bounds bounds;
+				bounds.width = jpeg.width(scale);
+				bounds.height = jpeg.height(scale);
+				bounds.outside = false;
+
+				if (jpeg.decode(writeBlock, &bounds, 0, 0, scale))
+				{
+					decoded++;
+				}
+				else
+				{
+					failed++;
+				}
+				CHECK(!bounds.outside);
+			}
+		}
+	}
+
+	printf("%d decodes: %d finished, %d failed\n", decoded + failed, decoded, failed);
+	return checkResult();
+}
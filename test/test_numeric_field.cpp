@@ -0,0 +1,57 @@
+//  NumericField's number formatting.  After printing a value, printing the text it
+//  should have shown redraws no cells, so sends nothing.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_NumericField.h>
+
+#include "check.h"
+
+namespace
+{
+	Waveshare_ILI9486 tft;
+	Waveshare_ILI9486_NumericField<Waveshare_ILI9486> field(tft, 0, 0, 12);
+
+	//  Bytes sent for printing 'pExpected' over whatever the field shows now.
+	uint32_t redrawn(const char *pExpected)
+	{
+		const uint32_t before = Waveshare_ILI9486_Impl::hostBytesWritten();
+		field.print(pExpected);
+		return Waveshare_ILI9486_Impl::hostBytesWritten() - before;
+	}
+}
+
+int main()
+{
+	CHECK(tft.begin());
+
+	field.print(2.5, 1);
+	CHECK_EQUAL(redrawn("2.5"), 0UL);
+	field.print(-1.25, 1);
+	CHECK_EQUAL(redrawn("-1.3"), 0UL);
+	field.print(12345L);
+	CHECK_EQUAL(redrawn("12345"), 0UL);
+	field.print(4294967000.0, 0);
+	CHECK_EQUAL(redrawn("4294967000"), 0UL);
+
+	//  Past 32 bits, or not a number - as Print::printFloat does it.
+	field.print(NAN, 2);
+	CHECK_EQUAL(redrawn("nan"), 0UL);
+	field.print(INFINITY, 2);
+	CHECK_EQUAL(redrawn("inf"), 0UL);
+	field.print(2.5, 1);
+	field.print(-INFINITY, 2);
+	CHECK_EQUAL(redrawn("inf"), 0UL);
+	field.print(1e20, 2);
+	CHECK_EQUAL(redrawn("ovf"), 0UL);
+	field.print(2.5, 1);
+	field.print(-42949673.0, 2);
+	CHECK_EQUAL(redrawn("ovf"), 0UL);
+
+	//  And a check that 'redrawn()' sees a change.
+	CHECK(redrawn("1") != 0);
+
+	return checkResult();
+}
@@ -0,0 +1,153 @@
+//  Replays a recorded touch trace through 'getPoint()' and 'normalizeTsPoint()' on the
+//  host, and reports what the pipeline made of it.
+//
+//  The trace is C source as 'Waveshare_ILI9486_TouchTrace::printTo()' writes it - the
+//  TouchTrace example records one on the device and prints it to Serial.  Save that to
+//  a file and point the build at it:
+//
+//      cmake -S test -B build -DWAVESHARE_ILI9486_TOUCH_TRACE=/path/to/trace.h
+//
+//  The default is traces/synthetic.h.  The same trace can then be run against each
+//  variant of the pipeline (NUMSAMPLES, 'slop', calibration).  Replay reads no
+//  hardware, so the time reported is the filtering alone, on this machine.
+//
+//  Fails if the trace doesn't match the pipeline - readings skipped because it asked
+//  for a channel the trace doesn't have next - or if replaying twice doesn't give the
+//  same points.
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Adafruit_GFX.h>
+#include <Waveshare_ILI9486.h>
+#include <Waveshare_ILI9486_TouchTrace.h>
+
+namespace recorded
+{
+#include WAVESHARE_ILI9486_TOUCH_TRACE
+}
+
+namespace
+{
+	Waveshare_ILI9486 tft;
+
+	constexpr uint16_t SAMPLES = sizeof(recorded::trace) / sizeof(recorded::trace[0]);
+	Waveshare_ILI9486_TouchTrace trace(recorded::trace, SAMPLES, SAMPLES);
+
+	//  Raw X readings below this are 'no touch' - 'getPoint()' maps them to 0.
+	constexpr uint16_t CONTACT = 4;
+	constexpr uint8_t CHANNEL_X = 0b11010000;
+
+	struct Report
+	{
+		uint32_t calls;
+		uint32_t valid;
+		uint32_t busy;
+		uint32_t strokes;
+		uint32_t latencyTotal;
+		uint32_t latencyWorst;
+		uint32_t pointSum;          //  Of every normalized point, to compare replays.
+	};
+
+	//  Replays the whole trace, and prints:
+	//  - calls     'getPoint()' calls it took to use up the trace
+	//  - valid     percentage of calls returning a point
+	//  - us/call   filtering cost per call, and per controller reading
+	//  - latency   trace time from the first contact of each stroke to its first point
+	Report replay(const char *pName)
+	{
+		Report report = {};
+		bool touching = false, reported = false;
+		uint32_t strokeStart = 0;
+
+		trace.startReplay();
+		while (!trace.isFinished())
+		{
+			const uint16_t first = trace.position();
+			uint32_t t = trace.time();
+
+			const uint32_t start = micros();
+			TSPoint p = tft.getPoint();
+			tft.normalizeTsPoint(p);
+			report.busy += micros() - start;
+			report.calls++;
+
+			//  Follow contact through the readings this call used.
+			const Waveshare_ILI9486_TouchTrace::Sample *pSamples = trace.samples();
+			for (uint16_t i = first; i < trace.position(); i++)
+			{
+				t += pSamples[i].dt;
+				if (Waveshare_ILI9486_TouchTrace::channel(pSamples[i]) != CHANNEL_X) continue;
+
+				const bool contact = Waveshare_ILI9486_TouchTrace::value(pSamples[i]) >= CONTACT;
+				if (contact && !touching)
+				{
+					strokeStart = t;
+					reported = false;
+					report.strokes++;
+				}
+				touching = contact;
+			}
+
+			if (p.z != 0)
+			{
+				report.valid++;
+				report.pointSum = report.pointSum * 31 + (uint32_t)p.x * 1000 + p.y;
+				if (touching && !reported)
+				{
+					const uint32_t latency = trace.time() - strokeStart;
+					report.latencyTotal += latency;
+					if (latency > report.latencyWorst) report.latencyWorst = latency;
+					reported = true;
+				}
+			}
+		}
+		trace.stop();
+
+		printf("%s: calls %lu, valid %lu%%, us/call %.3f, us/reading %.3f, strokes %lu, "
+			"latency us mean %lu worst %lu, skipped %u\n",
+			pName,
+			(unsigned long)report.calls,
+			(unsigned long)(report.calls ? 100 * report.valid / report.calls : 0),
+			report.calls ? (double)report.busy / report.calls : 0.0,
+			trace.count() ? (double)report.busy / trace.count() : 0.0,
+			(unsigned long)report.strokes,
+			(unsigned long)(report.strokes ? report.latencyTotal / report.strokes : 0),
+			(unsigned long)report.latencyWorst,
+			trace.skipped());
+
+		return report;
+	}
+}
+
+int main()
+{
+	tft.begin();
+	tft.attachTouchTrace(&trace);
+
+	printf("%s, %u samples\n", WAVESHARE_ILI9486_TOUCH_TRACE, SAMPLES);
+
+	//  From scratch, learning the calibration as it goes, then again with what it learned.
+	tft.resetTsConfigData();
+	replay("default calibration");
+	if (trace.skipped() != 0)
+	{
+		printf("the trace doesn't match this pipeline - was it recorded with another NUMSAMPLES?\n");
+		return 1;
+	}
+
+	const TSConfigData learned = tft.getTsConfigData();
+	printf("learned calibration: x %d - %d, y %d - %d\n",
+		learned.xMin, learned.xMax, learned.yMin, learned.yMax);
+	const Report first = replay("learned calibration");
+	tft.setTsConfigData(learned);
+	const Report second = replay("learned calibration, again");
+
+	tft.attachTouchTrace(nullptr);
+
+	if ((first.calls != second.calls) || (first.valid != second.valid) || (first.pointSum != second.pointSum))
+	{
+		printf("replaying the same trace twice gave different points\n");
+		return 1;
+	}
+	return 0;
+}
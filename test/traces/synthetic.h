@@ -0,0 +1,309 @@
+//  Synthetic - six strokes of 30 to 45 calls, a call every 2 ms, reading noise of a
+//  few counts with the odd spike, and bounce as the stylus lands and lifts.  From
+//  here on it's what 'printTo()' writes.
+// 2424 samples
+Waveshare_ILI9486_TouchTrace::Sample trace[] = {
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xAEF1}, {25, 0xAF1F}, {25, 0xAF01}, {25, 0x2F4F}, {25, 0x2F4E},
+	{1800, 0xAE88}, {25, 0xAEAF}, {25, 0xAE86}, {25, 0x2F3B}, {25, 0x2F3F}, {1800, 0xAE2C}, {25, 0xAE30}, {25, 0xAE2F},
+	{25, 0x2EF8}, {25, 0x2EF8}, {25, 0x62B6}, {25, 0x8832}, {25, 0xAE2D}, {1800, 0xADBC}, {25, 0xADC0}, {25, 0xADBD},
+	{25, 0x2EC8}, {25, 0x2EC7}, {25, 0x62BB}, {25, 0x883A}, {25, 0xADC0}, {1800, 0xAD4C}, {25, 0xAD4D}, {25, 0xAD4F},
+	{25, 0x2E96}, {25, 0x2E96}, {25, 0x62B8}, {25, 0x8832}, {25, 0xAD4E}, {1800, 0xACDB}, {25, 0xACD8}, {25, 0xACDA},
+	{25, 0x2E66}, {25, 0x2E68}, {25, 0x62BC}, {25, 0x882D}, {25, 0xACDB}, {1800, 0xAC6B}, {25, 0xAC68}, {25, 0xAC6C},
+	{25, 0x2E32}, {25, 0x2E34}, {25, 0x62BF}, {25, 0x8832}, {25, 0xAC68}, {1800, 0xABF5}, {25, 0xAC06}, {25, 0xABF7},
+	{25, 0x2DF4}, {25, 0x2DF9}, {1800, 0xAB8B}, {25, 0xAB8A}, {25, 0xAB8B}, {25, 0x2DCE}, {25, 0x2DCD}, {25, 0x62BF},
+	{25, 0x8837}, {25, 0xAB89}, {1800, 0xAB18}, {25, 0xAB1C}, {25, 0xAB19}, {25, 0x2DA0}, {25, 0x2D9D}, {25, 0x62B9},
+	{25, 0x883A}, {25, 0xAB1B}, {1800, 0xAAAC}, {25, 0xAAA9}, {25, 0xAAAA}, {25, 0x2D68}, {25, 0x2D69}, {25, 0x62B5},
+	{25, 0x8836}, {25, 0xAAAB}, {1800, 0xAA39}, {25, 0xAA3C}, {25, 0xAA3A}, {25, 0x2D35}, {25, 0x2D37}, {25, 0x62C0},
+	{25, 0x883A}, {25, 0xAA39}, {1800, 0xA9C5}, {25, 0xA9C8}, {25, 0xA9C8}, {25, 0x2D06}, {25, 0x2D08}, {25, 0x62C1},
+	{25, 0x8838}, {25, 0xA9C6}, {1800, 0xA955}, {25, 0xA958}, {25, 0xA957}, {25, 0x2CD4}, {25, 0x2CD4}, {25, 0x62B7},
+	{25, 0x8830}, {25, 0xA955}, {1800, 0xA8E7}, {25, 0xA8E8}, {25, 0xA8E4}, {25, 0x2CA3}, {25, 0x2CA3}, {25, 0x62C2},
+	{25, 0x883C}, {25, 0xA8E6}, {1800, 0xA874}, {25, 0xA874}, {25, 0xA878}, {25, 0x2C6E}, {25, 0x2C6E}, {25, 0x62B7},
+	{25, 0x8835}, {25, 0xA877}, {1800, 0xA804}, {25, 0xA806}, {25, 0xA808}, {25, 0x2C3D}, {25, 0x2C40}, {25, 0x62B7},
+	{25, 0x8835}, {25, 0xA808}, {1800, 0xA795}, {25, 0xA796}, {25, 0xA795}, {25, 0x2C10}, {25, 0x2C10}, {25, 0x62B4},
+	{25, 0x8836}, {25, 0xA797}, {1800, 0xA725}, {25, 0xA723}, {25, 0xA721}, {25, 0x2BCF}, {25, 0x2BD5}, {25, 0x62B6},
+	{25, 0x882E}, {25, 0xA731}, {1800, 0xA6B4}, {25, 0xA6B8}, {25, 0xA6B5}, {25, 0x2BA5}, {25, 0x2BA7}, {25, 0x62B9},
+	{25, 0x8834}, {25, 0xA6B8}, {1800, 0xA647}, {25, 0xA645}, {25, 0xA648}, {25, 0x2B75}, {25, 0x2B76}, {25, 0x62C0},
+	{25, 0x8837}, {25, 0xA647}, {1800, 0xA5D3}, {25, 0xA5D0}, {25, 0xA5D1}, {25, 0x2B45}, {25, 0x2B44}, {25, 0x62BE},
+	{25, 0x882C}, {25, 0xA5D4}, {1800, 0xA564}, {25, 0xA561}, {25, 0xA560}, {25, 0x2B10}, {25, 0x2B10}, {25, 0x62BB},
+	{25, 0x882E}, {25, 0xA560}, {1800, 0xA4F0}, {25, 0xA4F4}, {25, 0xA4F1}, {25, 0x2ADE}, {25, 0x2ADF}, {25, 0x62BA},
+	{25, 0x8830}, {25, 0xA4F4}, {1800, 0xA481}, {25, 0xA483}, {25, 0xA483}, {25, 0x2AAD}, {25, 0x2AAC}, {25, 0x62B7},
+	{25, 0x8839}, {25, 0xA482}, {1800, 0xA413}, {25, 0xA410}, {25, 0xA410}, {25, 0x2A7C}, {25, 0x2A7F}, {25, 0x62BE},
+	{25, 0x882F}, {25, 0xA411}, {1800, 0xA3A4}, {25, 0xA3A3}, {25, 0xA3A1}, {25, 0x2A4B}, {25, 0x2A49}, {25, 0x62BC},
+	{25, 0x883A}, {25, 0xA3A1}, {1800, 0xA330}, {25, 0xA333}, {25, 0xA334}, {25, 0x2A14}, {25, 0x2A14}, {25, 0x62B4},
+	{25, 0x882E}, {25, 0xA331}, {1800, 0xA2BF}, {25, 0xA2BF}, {25, 0xA2BD}, {25, 0x29E7}, {25, 0x29E4}, {25, 0x62B9},
+	{25, 0x8838}, {25, 0xA2BC}, {1800, 0xA24E}, {25, 0xA24F}, {25, 0xA24E}, {25, 0x29B7}, {25, 0x29B8}, {25, 0x62C3},
+	{25, 0x8830}, {25, 0xA24D}, {1800, 0xA1DC}, {25, 0xA1E0}, {25, 0xA1E0}, {25, 0x2980}, {25, 0x2982}, {25, 0x62B5},
+	{25, 0x882D}, {25, 0xA1E0}, {1800, 0xA170}, {25, 0xA16D}, {25, 0xA16C}, {25, 0x2950}, {25, 0x294C}, {25, 0x62B9},
+	{25, 0x882E}, {25, 0xA170}, {1800, 0xA0E4}, {25, 0xA10B}, {25, 0xA117}, {25, 0x290F}, {25, 0x2919}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA835},
+	{25, 0xA836}, {25, 0xA812}, {25, 0x2EC7}, {25, 0x2EA5}, {1800, 0xA826}, {25, 0xA836}, {25, 0xA831}, {25, 0x2E68},
+	{25, 0x2E65}, {25, 0x62BE}, {25, 0x8834}, {25, 0xA819}, {1800, 0xA82A}, {25, 0xA829}, {25, 0xA82A}, {25, 0x2E07},
+	{25, 0x2E05}, {25, 0x62BD}, {25, 0x883A}, {25, 0xA82A}, {1800, 0xA824}, {25, 0xA824}, {25, 0xA827}, {25, 0x2DB0},
+	{25, 0x2DB0}, {25, 0x62B7}, {25, 0x882E}, {25, 0xA828}, {1800, 0xA826}, {25, 0xA825}, {25, 0xA826}, {25, 0x2D50},
+	{25, 0x2D51}, {25, 0x62BF}, {25, 0x8835}, {25, 0xA825}, {1800, 0xA824}, {25, 0xA822}, {25, 0xA824}, {25, 0x2CF8},
+	{25, 0x2CF4}, {25, 0x62BD}, {25, 0x882F}, {25, 0xA821}, {1800, 0xA820}, {25, 0xA824}, {25, 0xA821}, {25, 0x2C9A},
+	{25, 0x2C9A}, {25, 0x62BA}, {25, 0x8836}, {25, 0xA821}, {1800, 0xA81E}, {25, 0xA820}, {25, 0xA81F}, {25, 0x2C42},
+	{25, 0x2C40}, {25, 0x62B6}, {25, 0x8839}, {25, 0xA81E}, {1800, 0xA81C}, {25, 0xA82A}, {25, 0xA816}, {25, 0x2BEE},
+	{25, 0x2BE2}, {1800, 0xA81B}, {25, 0xA81C}, {25, 0xA81B}, {25, 0x2B8C}, {25, 0x2B88}, {25, 0x62B7}, {25, 0x882E},
+	{25, 0xA819}, {1800, 0xA816}, {25, 0xA818}, {25, 0xA818}, {25, 0x2B2D}, {25, 0x2B2F}, {25, 0x62B8}, {25, 0x882D},
+	{25, 0xA816}, {1800, 0xA814}, {25, 0xA816}, {25, 0xA815}, {25, 0x2AD1}, {25, 0x2AD0}, {25, 0x62BF}, {25, 0x8839},
+	{25, 0xA818}, {1800, 0xA811}, {25, 0xA811}, {25, 0xA811}, {25, 0x2A7B}, {25, 0x2A78}, {25, 0x62B9}, {25, 0x8836},
+	{25, 0xA813}, {1800, 0xA811}, {25, 0xA812}, {25, 0xA811}, {25, 0x2A1C}, {25, 0x2A1F}, {25, 0x62B5}, {25, 0x883B},
+	{25, 0xA811}, {1800, 0xA80F}, {25, 0xA80E}, {25, 0xA80E}, {25, 0x29C1}, {25, 0x29C1}, {25, 0x62B4}, {25, 0x8832},
+	{25, 0xA80F}, {1800, 0xA80C}, {25, 0xA80E}, {25, 0xA80E}, {25, 0x2968}, {25, 0x2967}, {25, 0x62BE}, {25, 0x882C},
+	{25, 0xA80C}, {1800, 0xA80A}, {25, 0xA809}, {25, 0xA80C}, {25, 0x290E}, {25, 0x290C}, {25, 0x62B7}, {25, 0x8839},
+	{25, 0xA80A}, {1800, 0xA80A}, {25, 0xA80B}, {25, 0xA80C}, {25, 0x28B4}, {25, 0x28B0}, {25, 0x62C0}, {25, 0x8832},
+	{25, 0xA80A}, {1800, 0xA807}, {25, 0xA7FA}, {25, 0xA80A}, {25, 0x285B}, {25, 0x285F}, {1800, 0xA801}, {25, 0xA802},
+	{25, 0xA803}, {25, 0x27F8}, {25, 0x27FA}, {25, 0x62BE}, {25, 0x882F}, {25, 0xA802}, {1800, 0xA803}, {25, 0xA802},
+	{25, 0xA803}, {25, 0x279E}, {25, 0x27A0}, {25, 0x62B8}, {25, 0x8832}, {25, 0xA803}, {1800, 0xA7FF}, {25, 0xA7FD},
+	{25, 0xA800}, {25, 0x2748}, {25, 0x2746}, {25, 0x62C0}, {25, 0x882C}, {25, 0xA7FE}, {1800, 0xA7FF}, {25, 0xA800},
+	{25, 0xA800}, {25, 0x26EA}, {25, 0x26EB}, {25, 0x62C2}, {25, 0x883A}, {25, 0xA7FD}, {1800, 0xA7F9}, {25, 0xA7F8},
+	{25, 0xA7FA}, {25, 0x2690}, {25, 0x2690}, {25, 0x62BE}, {25, 0x882E}, {25, 0xA7F9}, {1800, 0xA7F9}, {25, 0xA7F9},
+	{25, 0xA7F9}, {25, 0x2630}, {25, 0x2630}, {25, 0x62BB}, {25, 0x883B}, {25, 0xA7FC}, {1800, 0xA7F4}, {25, 0xA7F7},
+	{25, 0xA7F7}, {25, 0x25DC}, {25, 0x25D9}, {25, 0x62C0}, {25, 0x883B}, {25, 0xA7F7}, {1800, 0xA7F4}, {25, 0xA7F4},
+	{25, 0xA7F7}, {25, 0x257D}, {25, 0x257D}, {25, 0x62C4}, {25, 0x883A}, {25, 0xA7F4}, {1800, 0xA7F0}, {25, 0xA7F3},
+	{25, 0xA7F1}, {25, 0x2523}, {25, 0x2524}, {25, 0x62BE}, {25, 0x883A}, {25, 0xA7F4}, {1800, 0xA7F0}, {25, 0xA7EF},
+	{25, 0xA7F0}, {25, 0x24C7}, {25, 0x24C5}, {25, 0x62C3}, {25, 0x883A}, {25, 0xA7EE}, {1800, 0xA7EE}, {25, 0xA7F0},
+	{25, 0xA7EF}, {25, 0x2469}, {25, 0x246A}, {25, 0x62C2}, {25, 0x882E}, {25, 0xA7EE}, {1800, 0xA7EA}, {25, 0xA7EA},
+	{25, 0xA7EC}, {25, 0x2410}, {25, 0x2411}, {25, 0x62B8}, {25, 0x8833}, {25, 0xA7EB}, {1800, 0xA7E9}, {25, 0xA7E8},
+	{25, 0xA7EB}, {25, 0x23B7}, {25, 0x23B6}, {25, 0x62C2}, {25, 0x8839}, {25, 0xA7E8}, {1800, 0xA7E7}, {25, 0xA7E7},
+	{25, 0xA7E8}, {25, 0x2358}, {25, 0x235C}, {25, 0x62C0}, {25, 0x883B}, {25, 0xA7E4}, {1800, 0xA7E6}, {25, 0xA7E7},
+	{25, 0xA7E7}, {25, 0x2300}, {25, 0x2300}, {25, 0x62BB}, {25, 0x883B}, {25, 0xA7E5}, {1800, 0xA7E3}, {25, 0xA7E0},
+	{25, 0xA7E3}, {25, 0x22A6}, {25, 0x22A7}, {25, 0x62B9}, {25, 0x883A}, {25, 0xA7E1}, {1800, 0xA7E4}, {25, 0xA7E0},
+	{25, 0xA7E3}, {25, 0x224C}, {25, 0x224C}, {25, 0x62B4}, {25, 0x882E}, {25, 0xA7E3}, {1800, 0xA7C8}, {25, 0xA7F7},
+	{25, 0xA7DD}, {25, 0x21DB}, {25, 0x21D3}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA1E4}, {25, 0xA1DD}, {25, 0xA1ED}, {25, 0x211C}, {25, 0x211D}, {1800, 0xA24C},
+	{25, 0xA254}, {25, 0xA234}, {25, 0x2115}, {25, 0x2134}, {1800, 0xA287}, {25, 0xA286}, {25, 0xA284}, {25, 0x2123},
+	{25, 0x2120}, {25, 0x62B5}, {25, 0x8837}, {25, 0xA285}, {1800, 0xA2D0}, {25, 0xA2D0}, {25, 0xA2D1}, {25, 0x211D},
+	{25, 0x211C}, {25, 0x62B8}, {25, 0x8833}, {25, 0xA2D1}, {1800, 0xA31C}, {25, 0xA320}, {25, 0xA31D}, {25, 0x211B},
+	{25, 0x211A}, {25, 0x62BF}, {25, 0x8831}, {25, 0xA320}, {1800, 0xA368}, {25, 0xA369}, {25, 0xA36A}, {25, 0x2114},
+	{25, 0x2118}, {25, 0x62B4}, {25, 0x8835}, {25, 0xA36C}, {1800, 0xA3B7}, {25, 0xA3B7}, {25, 0xA3B5}, {25, 0x2114},
+	{25, 0x2118}, {25, 0x62BB}, {25, 0x882F}, {25, 0xA3B6}, {1800, 0xA404}, {25, 0xA400}, {25, 0xA404}, {25, 0x2110},
+	{25, 0x2112}, {25, 0x62C1}, {25, 0x8837}, {25, 0xA400}, {1800, 0xA44E}, {25, 0xA44C}, {25, 0xA44F}, {25, 0x210F},
+	{25, 0x210C}, {25, 0x62C1}, {25, 0x8837}, {25, 0xA44F}, {1800, 0xA49B}, {25, 0xA499}, {25, 0xA49C}, {25, 0x210A},
+	{25, 0x210C}, {25, 0x62C3}, {25, 0x883A}, {25, 0xA49B}, {1800, 0xA4E8}, {25, 0xA4E6}, {25, 0xA4E6}, {25, 0x2109},
+	{25, 0x2108}, {25, 0x62BC}, {25, 0x883A}, {25, 0xA4E5}, {1800, 0xA534}, {25, 0xA534}, {25, 0xA533}, {25, 0x2106},
+	{25, 0x2104}, {25, 0x62C3}, {25, 0x8836}, {25, 0xA531}, {1800, 0xA57E}, {25, 0xA57E}, {25, 0xA57E}, {25, 0x2102},
+	{25, 0x2104}, {25, 0x62BC}, {25, 0x882C}, {25, 0xA580}, {1800, 0xA5C8}, {25, 0xA5C9}, {25, 0xA5CB}, {25, 0x20FF},
+	{25, 0x2100}, {25, 0x62BB}, {25, 0x883B}, {25, 0xA5CB}, {1800, 0xA614}, {25, 0xA614}, {25, 0xA616}, {25, 0x20FD},
+	{25, 0x20FF}, {25, 0x62BB}, {25, 0x8835}, {25, 0xA618}, {1800, 0xA664}, {25, 0xA664}, {25, 0xA662}, {25, 0x20FB},
+	{25, 0x20FC}, {25, 0x62BE}, {25, 0x8837}, {25, 0xA663}, {1800, 0xA6AE}, {25, 0xA6AD}, {25, 0xA6AC}, {25, 0x20F5},
+	{25, 0x20F6}, {25, 0x62B7}, {25, 0x8831}, {25, 0xA6AD}, {1800, 0xA6FB}, {25, 0xA6FA}, {25, 0xA6FC}, {25, 0x20F8},
+	{25, 0x20F8}, {25, 0x62BD}, {25, 0x882F}, {25, 0xA6F9}, {1800, 0xA746}, {25, 0xA745}, {25, 0xA746}, {25, 0x20F0},
+	{25, 0x20F4}, {25, 0x62B8}, {25, 0x8834}, {25, 0xA744}, {1800, 0xA794}, {25, 0xA792}, {25, 0xA791}, {25, 0x20EF},
+	{25, 0x20EC}, {25, 0x62B4}, {25, 0x8835}, {25, 0xA793}, {1800, 0xA7DE}, {25, 0xA7DD}, {25, 0xA7DC}, {25, 0x20EA},
+	{25, 0x20EB}, {25, 0x62B7}, {25, 0x882E}, {25, 0xA7DF}, {1800, 0xA830}, {25, 0xA82C}, {25, 0xA82D}, {25, 0x20E9},
+	{25, 0x20EC}, {25, 0x62BD}, {25, 0x882E}, {25, 0xA82D}, {1800, 0xA87B}, {25, 0xA87C}, {25, 0xA87C}, {25, 0x20E8},
+	{25, 0x20E5}, {25, 0x62C4}, {25, 0x8838}, {25, 0xA87B}, {1800, 0xA8C6}, {25, 0xA8C8}, {25, 0xA8C7}, {25, 0x20E2},
+	{25, 0x20E4}, {25, 0x62B5}, {25, 0x882F}, {25, 0xA8C5}, {1800, 0xA912}, {25, 0xA910}, {25, 0xA911}, {25, 0x20DD},
+	{25, 0x20DD}, {25, 0x62B6}, {25, 0x8831}, {25, 0xA910}, {1800, 0xA960}, {25, 0xA95F}, {25, 0xA95E}, {25, 0x20DC},
+	{25, 0x20DD}, {25, 0x62BD}, {25, 0x8835}, {25, 0xA95F}, {1800, 0xA9A9}, {25, 0xA9AA}, {25, 0xA9AC}, {25, 0x20D9},
+	{25, 0x20DB}, {25, 0x62B7}, {25, 0x8833}, {25, 0xA9A9}, {1800, 0xA9F5}, {25, 0xA9F4}, {25, 0xA9F4}, {25, 0x20D5},
+	{25, 0x20D6}, {25, 0x62BD}, {25, 0x883A}, {25, 0xA9F4}, {1800, 0xAA42}, {25, 0xAA43}, {25, 0xAA42}, {25, 0x20D8},
+	{25, 0x20D8}, {25, 0x62C3}, {25, 0x883A}, {25, 0xAA40}, {1800, 0xAA8F}, {25, 0xAA8E}, {25, 0xAA90}, {25, 0x20D2},
+	{25, 0x20D0}, {25, 0x62B6}, {25, 0x8833}, {25, 0xAA90}, {1800, 0xAAD8}, {25, 0xAADA}, {25, 0xAADC}, {25, 0x20CC},
+	{25, 0x20CD}, {25, 0x62C3}, {25, 0x883C}, {25, 0xAADB}, {1800, 0xAB25}, {25, 0xAB28}, {25, 0xAB27}, {25, 0x20CB},
+	{25, 0x20C8}, {25, 0x62C3}, {25, 0x8837}, {25, 0xAB27}, {1800, 0xAB70}, {25, 0xAB71}, {25, 0xAB72}, {25, 0x20CB},
+	{25, 0x20CB}, {25, 0x62BD}, {25, 0x8838}, {25, 0xAB74}, {1800, 0xABB4}, {25, 0xABBC}, {25, 0xABBA}, {25, 0x20C4},
+	{25, 0x20BD}, {25, 0x62C0}, {25, 0x883C}, {25, 0xABB2}, {1800, 0xAC0C}, {25, 0xAC0B}, {25, 0xAC0B}, {25, 0x20C0},
+	{25, 0x20C1}, {25, 0x62C4}, {25, 0x8837}, {25, 0xAC0C}, {1800, 0xAC57}, {25, 0xAC54}, {25, 0xAC55}, {25, 0x20BE},
+	{25, 0x20C0}, {25, 0x62B8}, {25, 0x8835}, {25, 0xAC57}, {1800, 0xACA3}, {25, 0xACA0}, {25, 0xACA0}, {25, 0x20C0},
+	{25, 0x20BD}, {25, 0x62B9}, {25, 0x8835}, {25, 0xACA4}, {1800, 0xACEF}, {25, 0xACE4}, {25, 0xACE9}, {25, 0x20B1},
+	{25, 0x20BC}, {1800, 0xAD39}, {25, 0xAD3B}, {25, 0xAD3A}, {25, 0x20B8}, {25, 0x20B6}, {25, 0x62C1}, {25, 0x883B},
+	{25, 0xAD3B}, {1800, 0xAD88}, {25, 0xAD85}, {25, 0xAD87}, {25, 0x20B1}, {25, 0x20B4}, {25, 0x62C4}, {25, 0x8830},
+	{25, 0xAD84}, {1800, 0xADD3}, {25, 0xADD2}, {25, 0xADD4}, {25, 0x20B2}, {25, 0x20B0}, {25, 0x62BD}, {25, 0x8835},
+	{25, 0xADD4}, {1800, 0xAE25}, {25, 0xAE2A}, {25, 0xAE1F}, {25, 0x20C7}, {25, 0x2099}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xAB46}, {25, 0xAB45}, {25, 0xAB53}, {25, 0x2B60},
+	{25, 0x2B52}, {1800, 0xAB24}, {25, 0xAB29}, {25, 0xAB47}, {25, 0x2B44}, {25, 0x2B67}, {1800, 0xAB05}, {25, 0xAB08},
+	{25, 0xAB07}, {25, 0x2B49}, {25, 0x2B4B}, {25, 0x62B5}, {25, 0x8836}, {25, 0xAB07}, {1800, 0xAAE3}, {25, 0xAAE3},
+	{25, 0xAAE1}, {25, 0x2B4B}, {25, 0x2B48}, {25, 0x62B8}, {25, 0x883C}, {25, 0xAAE4}, {1800, 0xAABC}, {25, 0xAABF},
+	{25, 0xAABC}, {25, 0x2B48}, {25, 0x2B47}, {25, 0x62B4}, {25, 0x8830}, {25, 0xAABF}, {1800, 0xAA99}, {25, 0xAA98},
+	{25, 0xAA9B}, {25, 0x2B46}, {25, 0x2B46}, {25, 0x62C0}, {25, 0x882E}, {25, 0xAA9A}, {1800, 0xAA74}, {25, 0xAA73},
+	{25, 0xAA72}, {25, 0x2B43}, {25, 0x2B44}, {25, 0x62B5}, {25, 0x882E}, {25, 0xAA71}, {1800, 0xAA4E}, {25, 0xAA4D},
+	{25, 0xAA4C}, {25, 0x2B43}, {25, 0x2B40}, {25, 0x62B7}, {25, 0x883A}, {25, 0xAA4D}, {1800, 0xAA28}, {25, 0xAA28},
+	{25, 0xAA2A}, {25, 0x2B3C}, {25, 0x2B3E}, {25, 0x62BF}, {25, 0x8837}, {25, 0xAA2B}, {1800, 0xAA08}, {25, 0xAA07},
+	{25, 0xAA08}, {25, 0x2B3D}, {25, 0x2B3D}, {25, 0x62B9}, {25, 0x882E}, {25, 0xAA08}, {1800, 0xA9E4}, {25, 0xA9E1},
+	{25, 0xA9E3}, {25, 0x2B3C}, {25, 0x2B39}, {25, 0x62BB}, {25, 0x883A}, {25, 0xA9E2}, {1800, 0xA9BC}, {25, 0xA9BF},
+	{25, 0xA9BE}, {25, 0x2B3C}, {25, 0x2B39}, {25, 0x62B6}, {25, 0x883A}, {25, 0xA9BE}, {1800, 0xA99A}, {25, 0xA99B},
+	{25, 0xA99A}, {25, 0x2B3B}, {25, 0x2B3A}, {25, 0x62BA}, {25, 0x8838}, {25, 0xA99B}, {1800, 0xA977}, {25, 0xA978},
+	{25, 0xA976}, {25, 0x2B38}, {25, 0x2B36}, {25, 0x62BD}, {25, 0x882C}, {25, 0xA977}, {1800, 0xA954}, {25, 0xA950},
+	{25, 0xA954}, {25, 0x2B37}, {25, 0x2B36}, {25, 0x62BB}, {25, 0x8837}, {25, 0xA951}, {1800, 0xA930}, {25, 0xA92E},
+	{25, 0xA92D}, {25, 0x2B30}, {25, 0x2B30}, {25, 0x62BD}, {25, 0x883A}, {25, 0xA92C}, {1800, 0xA909}, {25, 0xA908},
+	{25, 0xA90A}, {25, 0x2B32}, {25, 0x2B33}, {25, 0x62B9}, {25, 0x8832}, {25, 0xA909}, {1800, 0xA8E2}, {25, 0xA8E4},
+	{25, 0xA8E4}, {25, 0x2B2E}, {25, 0x2B2D}, {25, 0x62BC}, {25, 0x883B}, {25, 0xA8E2}, {1800, 0xA8BE}, {25, 0xA8BC},
+	{25, 0xA8BF}, {25, 0x2B2C}, {25, 0x2B2D}, {25, 0x62BB}, {25, 0x8838}, {25, 0xA8C0}, {1800, 0xA89B}, {25, 0xA898},
+	{25, 0xA89A}, {25, 0x2B2C}, {25, 0x2B28}, {25, 0x62C2}, {25, 0x8837}, {25, 0xA89A}, {1800, 0xA876}, {25, 0xA874},
+	{25, 0xA875}, {25, 0x2B2B}, {25, 0x2B28}, {25, 0x62BE}, {25, 0x8833}, {25, 0xA874}, {1800, 0xA853}, {25, 0xA852},
+	{25, 0xA853}, {25, 0x2B24}, {25, 0x2B25}, {25, 0x62B5}, {25, 0x882D}, {25, 0xA852}, {1800, 0xA82C}, {25, 0xA82C},
+	{25, 0xA82D}, {25, 0x2B28}, {25, 0x2B25}, {25, 0x62C0}, {25, 0x883A}, {25, 0xA82E}, {1800, 0xA80C}, {25, 0xA80B},
+	{25, 0xA80C}, {25, 0x2B25}, {25, 0x2B27}, {25, 0x62B7}, {25, 0x883B}, {25, 0xA80C}, {1800, 0xA7E6}, {25, 0xA7E4},
+	{25, 0xA7E6}, {25, 0x2B21}, {25, 0x2B23}, {25, 0x62C2}, {25, 0x8833}, {25, 0xA7E6}, {1800, 0xA7C2}, {25, 0xA7C4},
+	{25, 0xA7C2}, {25, 0x2B20}, {25, 0x2B23}, {25, 0x62BC}, {25, 0x8832}, {25, 0xA7C0}, {1800, 0xA79F}, {25, 0xA79C},
+	{25, 0xA79D}, {25, 0x2B20}, {25, 0x2B1C}, {25, 0x62B5}, {25, 0x8836}, {25, 0xA79D}, {1800, 0xA77C}, {25, 0xA779},
+	{25, 0xA778}, {25, 0x2B20}, {25, 0x2B1D}, {25, 0x62BA}, {25, 0x8833}, {25, 0xA77A}, {1800, 0xA754}, {25, 0xA750},
+	{25, 0xA752}, {25, 0x2B19}, {25, 0x2B19}, {25, 0x62BC}, {25, 0x8831}, {25, 0xA750}, {1800, 0xA72C}, {25, 0xA72D},
+	{25, 0xA72C}, {25, 0x2B1A}, {25, 0x2B19}, {25, 0x62BE}, {25, 0x882C}, {25, 0xA72D}, {1800, 0xA709}, {25, 0xA70B},
+	{25, 0xA70C}, {25, 0x2B14}, {25, 0x2B14}, {25, 0x62C3}, {25, 0x883A}, {25, 0xA70A}, {1800, 0xA6E4}, {25, 0xA6E7},
+	{25, 0xA6E8}, {25, 0x2B15}, {25, 0x2B18}, {25, 0x62B5}, {25, 0x883C}, {25, 0xA6E6}, {1800, 0xA6C0}, {25, 0xA6C0},
+	{25, 0xA6C3}, {25, 0x2B13}, {25, 0x2B13}, {25, 0x62B7}, {25, 0x883B}, {25, 0xA6C3}, {1800, 0xA69C}, {25, 0xA69E},
+	{25, 0xA6A0}, {25, 0x2B11}, {25, 0x2B10}, {25, 0x62B8}, {25, 0x8834}, {25, 0xA6A0}, {1800, 0xA67C}, {25, 0xA67A},
+	{25, 0xA67B}, {25, 0x2B14}, {25, 0x2B14}, {25, 0x62BD}, {25, 0x883A}, {25, 0xA67C}, {1800, 0xA654}, {25, 0xA654},
+	{25, 0xA658}, {25, 0x2B0D}, {25, 0x2B0F}, {25, 0x62C2}, {25, 0x8833}, {25, 0xA657}, {1800, 0xA633}, {25, 0xA633},
+	{25, 0xA633}, {25, 0x2B0C}, {25, 0x2B0E}, {25, 0x62C1}, {25, 0x8836}, {25, 0xA632}, {1800, 0xA60D}, {25, 0xA60F},
+	{25, 0xA60C}, {25, 0x2B08}, {25, 0x2B08}, {25, 0x62B6}, {25, 0x8839}, {25, 0xA60C}, {1800, 0xA5EA}, {25, 0xA5E9},
+	{25, 0xA5EC}, {25, 0x2B08}, {25, 0x2B0C}, {25, 0x62BE}, {25, 0x882F}, {25, 0xA5EB}, {1800, 0xA5C3}, {25, 0xA5C0},
+	{25, 0xA5C2}, {25, 0x2B08}, {25, 0x2B06}, {25, 0x62BF}, {25, 0x882F}, {25, 0xA5C4}, {1800, 0xA59D}, {25, 0xA59F},
+	{25, 0xA59D}, {25, 0x2B04}, {25, 0x2B06}, {25, 0x62BF}, {25, 0x882F}, {25, 0xA59E}, {1800, 0xA57B}, {25, 0xA57C},
+	{25, 0xA57C}, {25, 0x2B04}, {25, 0x2B04}, {25, 0x62B4}, {25, 0x8834}, {25, 0xA578}, {1800, 0xA556}, {25, 0xA556},
+	{25, 0xA556}, {25, 0x2B00}, {25, 0x2B01}, {25, 0x62B8}, {25, 0x8838}, {25, 0xA554}, {1800, 0xA530}, {25, 0xA530},
+	{25, 0xA534}, {25, 0x2AFD}, {25, 0x2AFF}, {25, 0x62C1}, {25, 0x883A}, {25, 0xA532}, {1800, 0xA4FA}, {25, 0xA507},
+	{25, 0xA503}, {25, 0x2B0E}, {25, 0x2AF4}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xAED8}, {25, 0xAEA3}, {25, 0xAEA9}, {25, 0x268A}, {25, 0x26B0},
+	{1800, 0xAEC7}, {25, 0xAEA3}, {25, 0xAECB}, {25, 0x26B9}, {25, 0x26C5}, {1800, 0xAEBF}, {25, 0xAEBF}, {25, 0xAEC0},
+	{25, 0x2707}, {25, 0x2707}, {25, 0x62BC}, {25, 0x8832}, {25, 0xAEC0}, {1800, 0xAEBF}, {25, 0xAEBC}, {25, 0xAEBE},
+	{25, 0x273C}, {25, 0x273B}, {25, 0x62C4}, {25, 0x8835}, {25, 0xAEBC}, {1800, 0xAEC0}, {25, 0xAEBC}, {25, 0xAEBC},
+	{25, 0x276D}, {25, 0x276E}, {25, 0x62BA}, {25, 0x8830}, {25, 0xAEBE}, {1800, 0xAEBC}, {25, 0xAEBC}, {25, 0xAEBF},
+	{25, 0x27A3}, {25, 0x27A1}, {25, 0x62B8}, {25, 0x8838}, {25, 0xAEC0}, {1800, 0xAEC0}, {25, 0xAEC0}, {25, 0xAEBE},
+	{25, 0x27D0}, {25, 0x27D3}, {25, 0x62B5}, {25, 0x8839}, {25, 0xAEBC}, {1800, 0xAEBC}, {25, 0xAEBE}, {25, 0xAEC0},
+	{25, 0x2807}, {25, 0x2808}, {25, 0x62C0}, {25, 0x8839}, {25, 0xAEBE}, {1800, 0xAEBC}, {25, 0xAEBE}, {25, 0xAEBD},
+	{25, 0x283C}, {25, 0x283B}, {25, 0x62BF}, {25, 0x882E}, {25, 0xAEBF}, {1800, 0xAEBD}, {25, 0xAEBF}, {25, 0xAEC0},
+	{25, 0x286F}, {25, 0x2870}, {25, 0x62B6}, {25, 0x8838}, {25, 0xAEBE}, {1800, 0xAEBD}, {25, 0xAEBE}, {25, 0xAEBD},
+	{25, 0x28A0}, {25, 0x28A4}, {25, 0x62B7}, {25, 0x883C}, {25, 0xAEC0}, {1800, 0xAEBE}, {25, 0xAEBE}, {25, 0xAEBD},
+	{25, 0x28D5}, {25, 0x28D4}, {25, 0x62B8}, {25, 0x8834}, {25, 0xAEBD}, {1800, 0xAEBD}, {25, 0xAEBC}, {25, 0xAEBD},
+	{25, 0x290B}, {25, 0x290B}, {25, 0x62C2}, {25, 0x8836}, {25, 0xAEBE}, {1800, 0xAEBC}, {25, 0xAEBF}, {25, 0xAEBF},
+	{25, 0x293E}, {25, 0x293E}, {25, 0x62B5}, {25, 0x8837}, {25, 0xAEC0}, {1800, 0xAEBF}, {25, 0xAEBF}, {25, 0xAEBC},
+	{25, 0x2970}, {25, 0x2972}, {25, 0x62BD}, {25, 0x882E}, {25, 0xAEBC}, {1800, 0xAEC0}, {25, 0xAEBF}, {25, 0xAEBF},
+	{25, 0x29A8}, {25, 0x29A8}, {25, 0x62B5}, {25, 0x883A}, {25, 0xAEC0}, {1800, 0xAEBE}, {25, 0xAEC0}, {25, 0xAEBF},
+	{25, 0x29D8}, {25, 0x29D5}, {25, 0x62B5}, {25, 0x883A}, {25, 0xAEBC}, {1800, 0xAEBE}, {25, 0xAEBC}, {25, 0xAEC0},
+	{25, 0x2A09}, {25, 0x2A08}, {25, 0x62BB}, {25, 0x883A}, {25, 0xAEBF}, {1800, 0xAEC0}, {25, 0xAEBD}, {25, 0xAEBE},
+	{25, 0x2A3E}, {25, 0x2A3E}, {25, 0x62C0}, {25, 0x8839}, {25, 0xAEBE}, {1800, 0xAEBC}, {25, 0xAEBE}, {25, 0xAEBC},
+	{25, 0x2A72}, {25, 0x2A70}, {25, 0x62C0}, {25, 0x8835}, {25, 0xAEBE}, {1800, 0xAEC0}, {25, 0xAEBD}, {25, 0xAEBE},
+	{25, 0x2AA4}, {25, 0x2AA8}, {25, 0x62B8}, {25, 0x8837}, {25, 0xAEBE}, {1800, 0xAEBF}, {25, 0xAEBD}, {25, 0xAEC0},
+	{25, 0x2AD8}, {25, 0x2ADA}, {25, 0x62C0}, {25, 0x8836}, {25, 0xAEBD}, {1800, 0xAEC0}, {25, 0xAEBC}, {25, 0xAEBF},
+	{25, 0x2B10}, {25, 0x2B0E}, {25, 0x62B4}, {25, 0x8837}, {25, 0xAEBE}, {1800, 0xAEBD}, {25, 0xAEBE}, {25, 0xAEBF},
+	{25, 0x2B41}, {25, 0x2B41}, {25, 0x62B8}, {25, 0x8830}, {25, 0xAEBC}, {1800, 0xAEBC}, {25, 0xAEC0}, {25, 0xAEC0},
+	{25, 0x2B78}, {25, 0x2B74}, {25, 0x62BE}, {25, 0x8830}, {25, 0xAEC0}, {1800, 0xAEBD}, {25, 0xAEBD}, {25, 0xAEC0},
+	{25, 0x2BA9}, {25, 0x2BAB}, {25, 0x62B5}, {25, 0x8839}, {25, 0xAEBE}, {1800, 0xAEBD}, {25, 0xAEBF}, {25, 0xAEC0},
+	{25, 0x2BDA}, {25, 0x2BDB}, {25, 0x62BB}, {25, 0x8833}, {25, 0xAEBE}, {1800, 0xAEBF}, {25, 0xAEBD}, {25, 0xAEBE},
+	{25, 0x2C10}, {25, 0x2C0F}, {25, 0x62C2}, {25, 0x8835}, {25, 0xAEBF}, {1800, 0xAEBF}, {25, 0xAEBD}, {25, 0xAEBD},
+	{25, 0x2C44}, {25, 0x2C41}, {25, 0x62BC}, {25, 0x882D}, {25, 0xAEBF}, {1800, 0xAEC0}, {25, 0xAEBC}, {25, 0xAEC0},
+	{25, 0x2C74}, {25, 0x2C76}, {25, 0x62B6}, {25, 0x8831}, {25, 0xAEBE}, {1800, 0xAEC0}, {25, 0xAEBD}, {25, 0xAEBF},
+	{25, 0x2CA8}, {25, 0x2CA9}, {25, 0x62C2}, {25, 0x8837}, {25, 0xAEBC}, {1800, 0xAEBA}, {25, 0xAEA3}, {25, 0xAEB9},
+	{25, 0x2CE0}, {25, 0x2CD7}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA9A5}, {25, 0xA9B7}, {25, 0xA9AE}, {25, 0x2811},
+	{25, 0x2824}, {1800, 0xA9C7}, {25, 0xA992}, {25, 0xA9C1}, {25, 0x2829}, {25, 0x2825}, {1800, 0xA991}, {25, 0xA991},
+	{25, 0xA990}, {25, 0x2802}, {25, 0x2803}, {25, 0x62B8}, {25, 0x883B}, {25, 0xA993}, {1800, 0xA97C}, {25, 0xA97C},
+	{25, 0xA97E}, {25, 0x27ED}, {25, 0x27ED}, {25, 0x62C4}, {25, 0x8839}, {25, 0xA97C}, {1800, 0xA969}, {25, 0xA96A},
+	{25, 0xA968}, {25, 0x27D8}, {25, 0x27D9}, {25, 0x62C1}, {25, 0x883A}, {25, 0xA968}, {1800, 0xA953}, {25, 0xA954},
+	{25, 0xA954}, {25, 0x27C0}, {25, 0x27C4}, {25, 0x62BB}, {25, 0x8830}, {25, 0xA952}, {1800, 0xA940}, {25, 0xA93E},
+	{25, 0xA93D}, {25, 0x27B0}, {25, 0x27AF}, {25, 0x62B9}, {25, 0x882E}, {25, 0xA940}, {1800, 0xA924}, {25, 0xA928},
+	{25, 0xA928}, {25, 0x2798}, {25, 0x2798}, {25, 0x62B4}, {25, 0x8838}, {25, 0xA927}, {1800, 0xA912}, {25, 0xA911},
+	{25, 0xA90E}, {25, 0x278D}, {25, 0x2776}, {1800, 0xA8FC}, {25, 0xA8FE}, {25, 0xA8FD}, {25, 0x276C}, {25, 0x2770},
+	{25, 0x62BE}, {25, 0x8830}, {25, 0xA8FC}, {1800, 0xA8E6}, {25, 0xA8E5}, {25, 0xA8E7}, {25, 0x2757}, {25, 0x2755},
+	{25, 0x62B8}, {25, 0x882E}, {25, 0xA8E7}, {1800, 0xA8CC}, {25, 0xA8C7}, {25, 0xA8CC}, {25, 0x2737}, {25, 0x2740},
+	{1800, 0xA8C0}, {25, 0xA8BF}, {25, 0xA8C0}, {25, 0x272F}, {25, 0x272E}, {25, 0x62B5}, {25, 0x8832}, {25, 0xA8BE},
+	{1800, 0xA8A4}, {25, 0xA8A6}, {25, 0xA8A6}, {25, 0x2714}, {25, 0x2716}, {25, 0x62C1}, {25, 0x8838}, {25, 0xA8A7},
+	{1800, 0xA893}, {25, 0xA892}, {25, 0xA891}, {25, 0x2703}, {25, 0x2703}, {25, 0x62BF}, {25, 0x883C}, {25, 0xA892},
+	{1800, 0xA87F}, {25, 0xA87C}, {25, 0xA87F}, {25, 0x26F0}, {25, 0x26ED}, {25, 0x62BD}, {25, 0x8836}, {25, 0xA87C},
+	{1800, 0xA866}, {25, 0xA866}, {25, 0xA867}, {25, 0x26D8}, {25, 0x26D7}, {25, 0x62B9}, {25, 0x883A}, {25, 0xA866},
+	{1800, 0xA852}, {25, 0xA854}, {25, 0xA853}, {25, 0x26C2}, {25, 0x26C0}, {25, 0x62B6}, {25, 0x8838}, {25, 0xA852},
+	{1800, 0xA839}, {25, 0xA838}, {25, 0xA839}, {25, 0x26AC}, {25, 0x26AB}, {25, 0x62B5}, {25, 0x8830}, {25, 0xA838},
+	{1800, 0xA826}, {25, 0xA826}, {25, 0xA827}, {25, 0x2698}, {25, 0x2694}, {25, 0x62B8}, {25, 0x883A}, {25, 0xA826},
+	{1800, 0xA810}, {25, 0xA814}, {25, 0xA811}, {25, 0x2684}, {25, 0x2682}, {25, 0x62C0}, {25, 0x8836}, {25, 0xA812},
+	{1800, 0xA7F8}, {25, 0xA7F8}, {25, 0xA7F9}, {25, 0x266B}, {25, 0x266C}, {25, 0x62C0}, {25, 0x882F}, {25, 0xA7FA},
+	{1800, 0xA7E7}, {25, 0xA7E5}, {25, 0xA7E8}, {25, 0x2656}, {25, 0x2657}, {25, 0x62BA}, {25, 0x882F}, {25, 0xA7E5},
+	{1800, 0xA7D3}, {25, 0xA7D1}, {25, 0xA7D3}, {25, 0x2640}, {25, 0x2642}, {25, 0x62BF}, {25, 0x882E}, {25, 0xA7D4},
+	{1800, 0xA7BA}, {25, 0xA7B9}, {25, 0xA7B9}, {25, 0x262A}, {25, 0x262C}, {25, 0x62BB}, {25, 0x882F}, {25, 0xA7B9},
+	{1800, 0xA7A5}, {25, 0xA7A7}, {25, 0xA7A4}, {25, 0x2616}, {25, 0x2618}, {25, 0x62BF}, {25, 0x883A}, {25, 0xA7A8},
+	{1800, 0xA78C}, {25, 0xA78C}, {25, 0xA78E}, {25, 0x25FF}, {25, 0x25FF}, {25, 0x62C4}, {25, 0x8839}, {25, 0xA78F},
+	{1800, 0xA778}, {25, 0xA779}, {25, 0xA77A}, {25, 0x25E8}, {25, 0x25EB}, {25, 0x62C2}, {25, 0x883C}, {25, 0xA77A},
+	{1800, 0xA768}, {25, 0xA768}, {25, 0xA765}, {25, 0x25D5}, {25, 0x25D7}, {25, 0x62C4}, {25, 0x882D}, {25, 0xA764},
+	{1800, 0xA74E}, {25, 0xA74D}, {25, 0xA74D}, {25, 0x25BE}, {25, 0x25BD}, {25, 0x62BF}, {25, 0x883C}, {25, 0xA74E},
+	{1800, 0xA73A}, {25, 0xA739}, {25, 0xA73C}, {25, 0x25AA}, {25, 0x25A9}, {25, 0x62BD}, {25, 0x882E}, {25, 0xA73C},
+	{1800, 0xA728}, {25, 0xA728}, {25, 0xA725}, {25, 0x2595}, {25, 0x2598}, {25, 0x62BE}, {25, 0x882D}, {25, 0xA724},
+	{1800, 0xA710}, {25, 0xA70E}, {25, 0xA70D}, {25, 0x2580}, {25, 0x257F}, {25, 0x62B4}, {25, 0x883B}, {25, 0xA710},
+	{1800, 0xA6FA}, {25, 0xA6FB}, {25, 0xA6F9}, {25, 0x256B}, {25, 0x256A}, {25, 0x62C2}, {25, 0x882E}, {25, 0xA6F8},
+	{1800, 0xA6E7}, {25, 0xA6E7}, {25, 0xA6E7}, {25, 0x2555}, {25, 0x2556}, {25, 0x62B8}, {25, 0x8836}, {25, 0xA6E6},
+	{1800, 0xA6CE}, {25, 0xA6CF}, {25, 0xA6CD}, {25, 0x253E}, {25, 0x2540}, {25, 0x62B7}, {25, 0x8836}, {25, 0xA6CD},
+	{1800, 0xA6BA}, {25, 0xA6BB}, {25, 0xA6B9}, {25, 0x2529}, {25, 0x2528}, {25, 0x62B5}, {25, 0x8835}, {25, 0xA6BB},
+	{1800, 0xA6A3}, {25, 0xA6A1}, {25, 0xA6A1}, {25, 0x2512}, {25, 0x2514}, {25, 0x62BE}, {25, 0x8832}, {25, 0xA6A1},
+	{1800, 0xA690}, {25, 0xA68F}, {25, 0xA68F}, {25, 0x24FE}, {25, 0x24FF}, {25, 0x62B4}, {25, 0x882E}, {25, 0xA68F},
+	{1800, 0xA679}, {25, 0xA679}, {25, 0xA67C}, {25, 0x24EA}, {25, 0x24E8}, {25, 0x62B5}, {25, 0x8835}, {25, 0xA67B},
+	{1800, 0xA663}, {25, 0xA662}, {25, 0xA664}, {25, 0x24D0}, {25, 0x24D0}, {25, 0x62C1}, {25, 0x8830}, {25, 0xA662},
+	{1800, 0xA65E}, {25, 0xA647}, {25, 0xA660}, {25, 0x24B9}, {25, 0x24B7}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+	{1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000},
+	{25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000},
+	{25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF},
+	{25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000},
+	{25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF}, {1800, 0xA000}, {25, 0xA000}, {25, 0xA000}, {25, 0x2FFF}, {25, 0x2FFF},
+};